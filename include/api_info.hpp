@@ -8,6 +8,7 @@
 #include <sqlext.h>
 #include <unordered_set>
 #include <set>
+#include "duckdb/common/types/column/column_data_collection.hpp"
 #include "duckdb/common/vector.hpp"
 
 #define NUM_FUNC_SUPPORTED 4000
@@ -69,11 +70,15 @@ public:
 
 	static void FindDataType(SQLSMALLINT data_type, vector<OdbcTypeInfo> &vec_types);
 
+	//! First supported type with the data type, nullptr when there is none
+	static const OdbcTypeInfo *FindFirstDataType(SQLSMALLINT data_type);
+
 	static SQLLEN PointerSizeOf(SQLSMALLINT sql_type);
 
 	static const vector<OdbcTypeInfo> &GetVectorTypesAddr();
 
-	static void WriteInfoTypesToQueryString(const vector<OdbcTypeInfo> &vec_types, string &query);
+	//! Appends a row per type to the collection, its columns are the result columns of SQLGetTypeInfo
+	static void WriteInfoTypesToCollection(const vector<OdbcTypeInfo> &vec_types, ColumnDataCollection &collection);
 
 	static bool IsNumericDescriptorField(SQLSMALLINT field_identifier);
 
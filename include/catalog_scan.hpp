@@ -0,0 +1,100 @@
+#ifndef CATALOG_SCAN_HPP
+#define CATALOG_SCAN_HPP
+
+#include "duckdb_odbc.hpp"
+
+namespace duckdb {
+
+//! Catalog, schema, table or column argument of a catalog function. It is a search pattern, or an identifier when
+//! SQL_ATTR_METADATA_ID is SQL_TRUE.
+class CatalogNameFilter {
+public:
+	//! Matches every name
+	CatalogNameFilter();
+
+	//! An empty search pattern matches every name
+	static CatalogNameFilter Pattern(const string &pattern);
+	static CatalogNameFilter Identifier(const string &identifier);
+	static CatalogNameFilter Exact(const string &name);
+	static CatalogNameFilter Nothing();
+	//! A search pattern or an identifier depending on SQL_ATTR_METADATA_ID
+	static CatalogNameFilter FromArgument(const string &argument, SQLUINTEGER metadata_id);
+	//! A case sensitive name or an identifier depending on SQL_ATTR_METADATA_ID, an empty name matches every name
+	static CatalogNameFilter FromOrdinaryArgument(const string &argument, SQLUINTEGER metadata_id);
+
+	//! Connection option with a comma separated list of catalogs the catalog functions do not enumerate
+	static const std::string EXCLUDE_CATALOGS_OPTION;
+	//! Names listed in the EXCLUDE_CATALOGS_OPTION value, a double quoted name can contain commas
+	static vector<string> ParseCatalogList(const string &catalogs);
+	//! The filter without the given catalogs, their names are compared case insensitively
+	CatalogNameFilter Excluding(const vector<string> &catalogs) const;
+
+	bool Matches(const string &name) const;
+	//! Returns true when at most one name, looked up case insensitively in the catalog, can match
+	bool IsSingleName() const;
+	const string &GetName() const {
+		return name;
+	}
+	//! Normalized form of the filter, part of the cache key of the result
+	string ToString() const;
+
+private:
+	enum class FilterType : uint8_t { ANY, NOTHING, EXACT, CASE_INSENSITIVE, LIKE };
+
+	CatalogNameFilter(FilterType type, string name);
+
+	FilterType type;
+	string name;
+	//! Names that never match, see Excluding
+	vector<string> excluded;
+};
+
+//! TableType argument of SQLTables, a comma separated list of quoted or unquoted table types
+class TableTypeFilter {
+public:
+	explicit TableTypeFilter(const string &table_types);
+
+	//! The table type is 'BASE TABLE', 'LOCAL TEMPORARY' or 'VIEW'
+	bool Matches(const string &table_type) const;
+	string ToString() const;
+
+private:
+	bool all;
+	vector<string> table_types;
+};
+
+//! Produces the result of SQLTables by walking the catalog entries that match the filters
+SQLRETURN CatalogTablesStmt(OdbcHandleStmt *hstmt, const CatalogNameFilter &catalog_filter,
+                            const CatalogNameFilter &schema_filter, const CatalogNameFilter &table_filter,
+                            const TableTypeFilter &table_type_filter);
+
+//! Special result sets of SQLTables, see SQL_ALL_CATALOGS, SQL_ALL_SCHEMAS and SQL_ALL_TABLE_TYPES
+enum class CatalogListType : uint8_t { CATALOGS, SCHEMAS, TABLE_TYPES };
+
+//! Produces the list of catalogs, schemas or table types of SQLTables. Only the column of the listed names is set.
+SQLRETURN CatalogListStmt(OdbcHandleStmt *hstmt, CatalogListType list_type);
+
+//! Produces the result of SQLColumns by walking the catalog entries that match the filters
+SQLRETURN CatalogColumnsStmt(OdbcHandleStmt *hstmt, const CatalogNameFilter &catalog_filter,
+                             const CatalogNameFilter &schema_filter, const CatalogNameFilter &table_filter,
+                             const CatalogNameFilter &column_filter);
+
+//! Produces the result of SQLPrimaryKeys from the PRIMARY KEY constraints of the matching tables
+SQLRETURN CatalogPrimaryKeysStmt(OdbcHandleStmt *hstmt, const CatalogNameFilter &catalog_filter,
+                                 const CatalogNameFilter &schema_filter, const CatalogNameFilter &table_filter);
+
+//! Produces the result of SQLForeignKeys. The tables on the foreign key side are walked when a foreign key table is
+//! given, otherwise the referenced tables are.
+SQLRETURN CatalogForeignKeysStmt(OdbcHandleStmt *hstmt, const CatalogNameFilter &pk_catalog_filter,
+                                 const CatalogNameFilter &pk_schema_filter, const CatalogNameFilter &pk_table_filter,
+                                 const CatalogNameFilter &fk_catalog_filter,
+                                 const CatalogNameFilter &fk_schema_filter, const CatalogNameFilter &fk_table_filter,
+                                 bool walk_fk_tables);
+
+//! Produces the result of SQLStatistics from the storage info, the unique constraints and the indexes of the tables
+SQLRETURN CatalogStatisticsStmt(OdbcHandleStmt *hstmt, const CatalogNameFilter &catalog_filter,
+                                const CatalogNameFilter &schema_filter, const CatalogNameFilter &table_filter,
+                                SQLUSMALLINT unique, SQLUSMALLINT reserved);
+
+} // namespace duckdb
+#endif // CATALOG_SCAN_HPP
@@ -28,6 +28,9 @@ public:
 	SQLRETURN SetConnection();
 	std::string GetOptionFromConfigMap(const std::string &key, const std::string &default_val = std::string());
 	void NormalizeWindowsPathSeparators(const std::string &option_name);
+	// True for ':memory:' and an empty path, such databases belong to a single connection. Named in-memory
+	// databases, ':memory:<name>', are shared by all connections of the process that use the same name.
+	static bool IsPrivateDatabase(const std::string &database);
 
 	// getters
 	std::string GetInputStr() {
@@ -38,6 +41,14 @@ public:
 	}
 
 private:
+	//! Names of the engine options and of the ODBC-local options, built once per process
+	struct OptionIndex {
+		unordered_set<string> names;
+		// in the order of DBConfig::GetOptionNames, used for the suggestions on an invalid keyword
+		vector<string> candidates;
+	};
+	static const OptionIndex &GetOptionIndex();
+
 	// Ignore keys automatically added by Excel, PowerBI and other popular ODBC clients
 	static const std::vector<std::string> IGNORE_KEYS;
 
@@ -45,7 +56,7 @@ private:
 	std::string input_str;
 	bool success_with_info = false;
 
-	map<string, bool> seen_config_options;
+	// the options set in the connection string or in the DSN, an option is set when it has an entry
 	case_insensitive_map_t<Value> config_map;
 	duckdb::DBConfig config;
 };
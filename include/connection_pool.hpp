@@ -0,0 +1,70 @@
+#ifndef CONNECTION_POOL_HPP
+#define CONNECTION_POOL_HPP
+
+#include "duckdb_odbc.hpp"
+
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/unordered_map.hpp"
+
+#include <chrono>
+
+namespace duckdb {
+
+//! Driver-side pool of the connections of environments with SQL_ATTR_CONNECTION_POOLING enabled. SQLDisconnect
+//! resets a pooled connection and keeps it idle, the next connect with the same pool key reuses it instead of
+//! creating a new connection and running the connection SQL of the 'session_init_sql_file' again.
+class ConnectionPool {
+public:
+	//! Idle connections kept per pool key, further released connections are closed
+	static constexpr idx_t MAX_IDLE_PER_KEY = 8;
+	//! Idle connections older than this are closed on the next pool access
+	static constexpr int64_t IDLE_TIMEOUT_SECONDS = 60;
+
+	struct Metrics {
+		idx_t hits;
+		idx_t misses;
+		idx_t idle;
+	};
+
+	static ConnectionPool &Get();
+
+	//! Builds the pool key from the database path and the connection options, with SQL_CP_STRICT_MATCH the
+	//! connection attributes set before connecting must match as well. Returns an empty key when the connection
+	//! cannot be pooled, e.g., for private in-memory databases.
+	static string GetKey(OdbcHandleDbc &dbc, const string &database, const case_insensitive_map_t<Value> &options);
+
+	//! Moves an idle connection with the given key into the dbc, returns false when there is none
+	bool Acquire(OdbcHandleDbc &dbc, const string &key);
+	//! Marks the connection of the dbc as pooled, its current settings are restored on every release
+	void Register(OdbcHandleDbc &dbc, const string &key);
+	//! Resets the connection of the dbc and keeps it idle, it is closed instead when it cannot be reset
+	void Release(OdbcHandleDbc &dbc);
+	//! Closes the idle connections pooled for an environment with SQL_CP_ONE_PER_HENV
+	void Purge(OdbcHandleEnv &env);
+	//! Returns the reused and newly created connections and the number of idle connections
+	Metrics GetMetrics();
+
+private:
+	struct IdleConnection {
+		shared_ptr<DuckDB> db;
+		unique_ptr<Connection> conn;
+		unique_ptr<ClientConfig> config;
+		std::chrono::steady_clock::time_point released_at;
+	};
+
+	//! Whether the session created objects in its temporary catalog, they cannot be handed to another session
+	static bool HasTemporaryObjects(ClientContext &context);
+	//! Rolls back and resets the session state, returns false when the connection cannot be reused
+	static bool Reset(Connection &conn, const ClientConfig &config);
+	//! Moves the idle connections that timed out into 'expired', they are closed without holding the lock
+	void RemoveExpired(vector<IdleConnection> &expired);
+
+private:
+	mutex lock;
+	unordered_map<string, vector<IdleConnection>> idle;
+	idx_t hits = 0;
+	idx_t misses = 0;
+};
+
+} // namespace duckdb
+#endif // CONNECTION_POOL_HPP
@@ -20,6 +20,13 @@ public:
 	SQLRETURN SetSqlDescType(SQLSMALLINT type);
 	SQLRETURN SetSqlDataType(SQLSMALLINT type);
 	void SetDescUnsignedField(const duckdb::LogicalType &type);
+	//! SQL_DESC_BASE_COLUMN_NAME and SQL_DESC_LABEL, the name of the column unless they were set
+	const std::string &GetBaseColumnName() const {
+		return sql_desc_base_column_name.empty() ? sql_desc_name : sql_desc_base_column_name;
+	}
+	const std::string &GetLabel() const {
+		return sql_desc_label.empty() ? sql_desc_name : sql_desc_label;
+	}
 
 public:
 	SQLSMALLINT sql_desc_auto_unique_value = SQL_FALSE; // DuckDB doesn't support auto unique value
@@ -27,7 +34,7 @@ public:
 	std::string sql_desc_base_table_name;
 	SQLINTEGER sql_desc_case_sensitive = SQL_FALSE; // DuckDB is case insensitive
 	std::string sql_desc_catalog_name;
-	SQLSMALLINT sql_desc_concise_type;
+	SQLSMALLINT sql_desc_concise_type = SQL_UNKNOWN_TYPE;
 	SQLPOINTER sql_desc_data_ptr;
 	SQLSMALLINT sql_desc_datetime_interval_code;
 	SQLINTEGER sql_desc_datetime_interval_precision;
@@ -51,7 +58,7 @@ public:
 	std::string sql_desc_schema_name;
 	SQLSMALLINT sql_desc_searchable;
 	std::string sql_desc_table_name;
-	SQLSMALLINT sql_desc_type;
+	SQLSMALLINT sql_desc_type = SQL_UNKNOWN_TYPE;
 	std::string sql_desc_type_name;
 	SQLSMALLINT sql_desc_unnamed;
 	SQLSMALLINT sql_desc_unsigned;
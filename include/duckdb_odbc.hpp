@@ -25,6 +25,7 @@
 
 namespace duckdb {
 
+class InsertBatch;
 class OdbcFetch;
 class ParameterDescriptor;
 class RowDescriptor;
@@ -44,17 +45,11 @@ struct OdbcHandle {
 };
 
 struct OdbcHandleEnv : public OdbcHandle {
-	OdbcHandleEnv() : OdbcHandle(OdbcHandleType::ENV) {
-		duckdb::DBConfig ODBC_CONFIG;
-		ODBC_CONFIG.SetOptionByName("duckdb_api", "odbc");
-		ODBC_CONFIG.SetOptionByName("threads", 1);
-		db = make_shared_ptr<DuckDB>(nullptr, &ODBC_CONFIG);
-	};
+	OdbcHandleEnv() : OdbcHandle(OdbcHandleType::ENV) {};
 
-	shared_ptr<DuckDB> db;
 	SQLINTEGER odbc_version;
-	SQLUINTEGER connection_pooling;
-	SQLUINTEGER cp_match;
+	SQLUINTEGER connection_pooling = SQL_CP_OFF;
+	SQLUINTEGER cp_match = SQL_CP_STRICT_MATCH;
 	SQLINTEGER output_nts;
 };
 
@@ -66,19 +61,29 @@ public:
 	explicit OdbcHandleDbc(OdbcHandleEnv *env_p)
 	    : OdbcHandle(OdbcHandleType::DBC), env(env_p), autocommit(true), sql_attr_access_mode(SQL_MODE_READ_WRITE) {
 		D_ASSERT(env_p);
-		D_ASSERT(env_p->db);
 	};
 	~OdbcHandleDbc();
 	void EraseStmtRef(OdbcHandleStmt *stmt);
-	SQLRETURN MaterializeResult();
+	//! Spills the open streaming result of the statements other than 'except', so that another query can run on the
+	//! connection while their cursors stay open. Errors are reported on the given handle.
+	SQLRETURN SpillStreamingResults(OdbcHandle *handle, OdbcHandleStmt *except = nullptr);
 	void ResetStmtDescriptors(OdbcHandleDesc *old_desc);
 
 	void SetDatabaseName(const string &db_name);
 	std::string GetDatabaseName();
 	std::string GetDataSourceName();
+	//! Name of the catalog reported in the IRD records, resolved once per database instance of the connection
+	const std::string &GetSystemCatalogName();
+	//! Inserts the rows buffered by the 'insert_batching' option, errors are reported on the given handle
+	SQLRETURN FlushInsertBatch(OdbcHandle *handle);
+	//! Drops the rows buffered by the 'insert_batching' option, e.g., on rollback
+	void ClearInsertBatch();
 
 public:
 	OdbcHandleEnv *env;
+	//! The database of the connection, see Connect::SetConnection. It is released on disconnect, so that the
+	//! instance cache and the keep-alive can close the database while the environment is still allocated.
+	shared_ptr<DuckDB> db;
 	duckdb::unique_ptr<Connection> conn;
 	bool autocommit;
 	SQLUINTEGER sql_attr_metadata_id;
@@ -90,6 +95,32 @@ public:
 	std::string dsn;
 	// reference to an open statement handled by this connection
 	vector<OdbcHandleStmt *> vec_stmt_ref;
+	// batch size set with the 'insert_batching' option, 0 when disabled
+	idx_t insert_batch_size = 0;
+	// statement with rows buffered by the 'insert_batching' option
+	OdbcHandleStmt *insert_batch_stmt = nullptr;
+	// SQL_ATTR_CONNECTION_TIMEOUT in seconds, only stored: it covers requests other than queries (HYT01), which the
+	// driver answers without waiting
+	SQLUINTEGER connection_timeout = 0;
+	// SQL_ATTR_ASYNC_ENABLE of the statements allocated on this connection
+	SQLULEN async_enable = SQL_ASYNC_ENABLE_OFF;
+	// statement with an asynchronous execution in progress, other statements cannot execute meanwhile
+	OdbcHandleStmt *async_stmt = nullptr;
+	// statement whose execution or fetch is running on the connection, see StatementCancelScope
+	OdbcHandleStmt *running_stmt = nullptr;
+	mutex running_lock;
+	// key under which the connection returns to the ConnectionPool on disconnect, empty when it is not pooled
+	std::string pool_key;
+	// database and baseline settings of a pooled connection
+	shared_ptr<DuckDB> pool_db;
+	duckdb::unique_ptr<ClientConfig> pool_config;
+	// statements describing the result columns of the catalog functions by function name, built once per connection
+	unordered_map<string, shared_ptr<PreparedStatementData>> metadata_statements;
+	// catalogs set with the 'metadata_exclude_catalogs' option, the catalog functions do not enumerate them
+	vector<string> metadata_excluded_catalogs;
+	// see GetSystemCatalogName
+	std::string system_catalog_name;
+	DatabaseInstance *system_catalog_db = nullptr;
 };
 
 struct OdbcBoundCol {
@@ -122,13 +153,22 @@ public:
 	explicit OdbcHandleStmt(OdbcHandleDbc *dbc_p);
 	~OdbcHandleStmt();
 	void Close();
-	SQLRETURN MaterializeResult();
+	//! Moves the rows of an open streaming result into a buffer-managed collection, the cursor position is kept
+	SQLRETURN SpillResult();
 	void SetARD(OdbcHandleDesc *new_ard);
 	void SetAPD(OdbcHandleDesc *new_apd);
 	bool IsPrepared() {
 		return stmt != nullptr;
 	}
 	void FillIRD();
+	//! Stops the asynchronous execution in progress, if any
+	void CancelPending();
+	//! Replaces the pending query and returns the previous one. SQLCancel reads it from another thread, so it is only
+	//! written under the running_lock of the connection.
+	duckdb::unique_ptr<PendingQueryResult> SwapPending(duckdb::unique_ptr<PendingQueryResult> new_pending = nullptr);
+	//! Requests the cancellation of the statement's running execution or fetch, other statements of the connection
+	//! are not affected. It does nothing when the statement is idle.
+	void Cancel();
 
 public:
 	OdbcHandleDbc *dbc;
@@ -138,6 +178,13 @@ public:
 	bool open;
 	SQLULEN retrieve_data = SQL_RD_ON;
 	SQLULEN *rows_fetched_ptr;
+	// SQL_ATTR_QUERY_TIMEOUT in seconds, 0 when disabled, see QueryWatchdog
+	SQLULEN query_timeout = 0;
+	// SQL_ATTR_ASYNC_ENABLE, when on the execution returns SQL_STILL_EXECUTING until the pending query is done
+	SQLULEN async_enable;
+	duckdb::unique_ptr<PendingQueryResult> pending;
+	// set by SQLCancel from any thread, the running call returns HY008
+	atomic<bool> canceled {false};
 
 	// statement attributes required by clients but not used by the engine
 	OdbcStmtClientAttrs client_attrs;
@@ -148,6 +195,15 @@ public:
 	duckdb::unique_ptr<ParameterDescriptor> param_desc;
 
 	duckdb::unique_ptr<RowDescriptor> row_desc;
+
+	// buffers the executions of a plain INSERT when the 'insert_batching' option is set
+	duckdb::unique_ptr<InsertBatch> insert_batch;
+
+	//! When not all parameters could be bound on Prepare, the result schema depends on the parameter types.
+	//! These are the types of the last executed parameter set, and the ones the current IRD was built for.
+	vector<LogicalType> executed_param_types;
+	vector<LogicalType> ird_param_types;
+	bool ird_param_types_valid = false;
 };
 
 struct OdbcHandleDesc : public OdbcHandle {
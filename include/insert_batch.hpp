@@ -0,0 +1,54 @@
+#ifndef INSERT_BATCH_HPP
+#define INSERT_BATCH_HPP
+
+#include "duckdb_odbc.hpp"
+
+#include "duckdb/main/appender.hpp"
+
+namespace duckdb {
+
+//! Buffers single-row executions of a prepared plain 'INSERT INTO t (cols) VALUES (?, ...)' statement and inserts
+//! them with a single statement, see the 'insert_batching' connection option
+class InsertBatch {
+public:
+	InsertBatch(string flush_query_p, vector<LogicalType> types_p, vector<idx_t> param_idxs_p, idx_t batch_size_p);
+	~InsertBatch() {
+	}
+
+	//! Returns nullptr when the prepared statement cannot be batched
+	static unique_ptr<InsertBatch> TryCreate(OdbcHandleStmt &hstmt, idx_t batch_size);
+
+	//! Buffers a row of parameter values, throws when the values cannot be converted to the column types
+	void Append(Connection &conn, vector<Value> &values);
+	//! Inserts the buffered rows, throws on errors. The buffer is empty afterwards in both cases
+	void Flush();
+	//! Drops the buffered rows without inserting them
+	void Clear();
+
+	bool IsFull() const {
+		return row_count >= batch_size;
+	}
+	bool IsEmpty() const {
+		return row_count == 0;
+	}
+
+	//! The result of a buffered execution, it reports a single inserted row like the INSERT would
+	static unique_ptr<QueryResult> BufferedRowResult(ClientContext &context);
+
+public:
+	//! Option name used in the connection string and in the DSN configuration
+	static const std::string BATCH_SIZE_OPTION;
+
+private:
+	string flush_query;
+	vector<LogicalType> types;
+	//! For every inserted column, the index of the parameter value
+	vector<idx_t> param_idxs;
+	idx_t batch_size;
+
+	unique_ptr<QueryAppender> appender;
+	idx_t row_count = 0;
+};
+
+} // namespace duckdb
+#endif // INSERT_BATCH_HPP
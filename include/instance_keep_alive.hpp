@@ -0,0 +1,48 @@
+#ifndef INSTANCE_KEEP_ALIVE_HPP
+#define INSTANCE_KEEP_ALIVE_HPP
+
+#include "duckdb_odbc.hpp"
+
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/unordered_map.hpp"
+
+#include <chrono>
+
+namespace duckdb {
+
+//! Keeps file database instances open for a grace period after their last connection is closed, so that the next
+//! connect finds a warm catalog and buffer pool instead of reopening the file, see the 'instance_idle_ttl_seconds'
+//! connection option. Idle instances are checkpointed, expired instances are closed on the next connect or
+//! disconnect of the driver.
+class InstanceKeepAlive {
+public:
+	//! Option name used in the connection string and in the DSN configuration
+	static const std::string IDLE_TTL_OPTION;
+	//! Idle instances are closed early, oldest first, while their buffer pools use more than this share of the
+	//! memory available to the process
+	static constexpr idx_t IDLE_MEMORY_SHARE_PERCENTAGE = 25;
+
+	static InstanceKeepAlive &Get();
+
+	//! Keeps the database alive for 'ttl_seconds' after its last connection is closed
+	void Register(const string &database, shared_ptr<DuckDB> db, idx_t ttl_seconds);
+	//! Checkpoints the instances that became idle and closes the expired ones
+	void Sweep();
+
+private:
+	struct KeptInstance {
+		shared_ptr<DuckDB> db;
+		std::chrono::seconds ttl;
+		bool idle = false;
+		std::chrono::steady_clock::time_point idle_since;
+	};
+
+	static void Checkpoint(DuckDB &db);
+
+private:
+	mutex lock;
+	unordered_map<string, KeptInstance> instances;
+};
+
+} // namespace duckdb
+#endif // INSTANCE_KEEP_ALIVE_HPP
@@ -0,0 +1,55 @@
+#ifndef METADATA_CACHE_HPP
+#define METADATA_CACHE_HPP
+
+#include "duckdb_odbc.hpp"
+
+#include "duckdb/common/types/column/column_data_collection.hpp"
+#include "duckdb/storage/object_cache.hpp"
+
+#include <functional>
+
+namespace duckdb {
+
+//! Materialized result of a catalog function, shared by the connections of a database instance through its object
+//! cache. The entry is valid as long as no DDL has been committed to any attached catalog.
+class CachedMetadataResult : public ObjectCacheEntry {
+public:
+	CachedMetadataResult(string catalog_state, StatementType statement_type, StatementProperties properties,
+	                     vector<string> names, unique_ptr<ColumnDataCollection> collection);
+
+	//! Identity and version of every attached catalog when the result was computed
+	const string catalog_state;
+	const StatementType statement_type;
+	const StatementProperties properties;
+	const vector<string> names;
+	const unique_ptr<ColumnDataCollection> collection;
+
+public:
+	static string ObjectType() {
+		return "odbc_metadata_result";
+	}
+	string GetObjectType() override {
+		return ObjectType();
+	}
+	optional_idx GetEstimatedCacheMemory() const override {
+		return optional_idx(collection->AllocationSize());
+	}
+};
+
+//! Computes the rows of a catalog function by walking the catalog, it runs in a transaction of the connection
+typedef std::function<unique_ptr<ColumnDataCollection>(ClientContext &context)> MetadataProducer;
+
+//! Executes a catalog function that enumerates the catalog natively (SQLTables, SQLColumns), the key identifies the
+//! function and its normalized arguments. A result that depends on the table data and not only on the catalog
+//! (SQLStatistics) is not cached.
+SQLRETURN ExecMetadataStmt(OdbcHandleStmt *hstmt, const string &component, const string &key,
+                           const vector<string> &names, const vector<LogicalType> &types,
+                           const MetadataProducer &producer, bool cacheable = true);
+
+//! Executes a catalog function whose result only depends on the driver build (SQLGetTypeInfo). The result is never
+//! freed, the cursor scans it without copying the chunks.
+SQLRETURN ExecStaticMetadataStmt(OdbcHandleStmt *hstmt, const string &component,
+                                 shared_ptr<CachedMetadataResult> result);
+
+} // namespace duckdb
+#endif // METADATA_CACHE_HPP
@@ -0,0 +1,14 @@
+#ifndef ODBC_ATTRIBUTES_HPP
+#define ODBC_ATTRIBUTES_HPP
+
+//! Driver-specific connection attributes, in the range ODBC reserves for drivers starting at
+//! SQL_DRIVER_CONN_ATTR_BASE. They are read-only and returned by SQLGetConnectAttr as SQLUBIGINT.
+
+//! Connects that reused an idle connection of the driver pool
+#define SQL_ATTR_DUCKDB_POOL_HITS 0x4001
+//! Connects to a pooled database that found no idle connection to reuse
+#define SQL_ATTR_DUCKDB_POOL_MISSES 0x4002
+//! Connections currently kept idle by the driver pool
+#define SQL_ATTR_DUCKDB_POOL_IDLE 0x4003
+
+#endif // ODBC_ATTRIBUTES_HPP
@@ -61,15 +61,6 @@ public:
 
 	static SQLRETURN SetStringValueLength(const std::string &val_str, SQLLEN *str_len_or_ind_ptr);
 
-	static std::string GetStringAsIdentifier(const std::string &str);
-	static std::string ParseStringFilter(const std::string &filter_name, const std::string &filter_value,
-	                                     SQLUINTEGER sql_attr_metadata_id, const std::string &coalesce_str = "");
-
-	static std::string GetQueryDuckdbTables(const std::string &catalog_filter, const std::string &schema_filter, const std::string &table_filter,
-	                                        const std::string &table_type_filter);
-	static std::string GetQueryDuckdbColumns(const std::string &catalog_filter, const std::string &schema_filter,
-	                                         const std::string &table_filter, const std::string &column_filter);
-
 	static SQLUINTEGER SQLPointerToSQLUInteger(SQLPOINTER value);
 	static std::string ConvertSQLCHARToString(SQLCHAR *str, const SQLINTEGER str_len);
 	static LPCSTR ConvertStringToLPCSTR(const std::string &str);
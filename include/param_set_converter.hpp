@@ -0,0 +1,44 @@
+#ifndef PARAM_SET_CONVERTER_HPP
+#define PARAM_SET_CONVERTER_HPP
+
+#include "parameter_descriptor.hpp"
+
+#include "duckdb/common/mutex.hpp"
+
+#include <condition_variable>
+#include <thread>
+
+namespace duckdb {
+
+//! Converts the parameter sets of an array execution on its own thread, ahead of the executing thread, so that the
+//! conversion of the set N+1 overlaps with the execution of the set N. The converting thread only reads the
+//! descriptors and the application buffers, the status array, the indicators and the diagnostics of the statement are
+//! written by the executing thread when it takes a set.
+class ParamSetConverter {
+public:
+	//! Parameter arrays smaller than this are converted by the executing thread
+	static constexpr SQLULEN MIN_PARAM_SETS = 8;
+
+	ParamSetConverter(ParameterDescriptor &param_desc, idx_t first_set, idx_t set_count);
+	~ParamSetConverter();
+
+	//! Waits for the set set_idx, returns false when it could not be converted ahead
+	bool Take(idx_t set_idx, PreconvertedParamSet &set);
+
+private:
+	void Run(idx_t first_set, idx_t set_count);
+
+private:
+	ParameterDescriptor &param_desc;
+	mutex lock;
+	std::condition_variable slot_changed;
+	std::thread thread;
+	//! The converted set waiting to be taken
+	PreconvertedParamSet slot;
+	bool slot_full = false;
+	//! Set when the last set is converted, a conversion failed or the executing thread is done
+	bool stop = false;
+};
+
+} // namespace duckdb
+#endif // PARAM_SET_CONVERTER_HPP
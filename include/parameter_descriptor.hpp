@@ -4,6 +4,14 @@
 #include "duckdb_odbc.hpp"
 
 namespace duckdb {
+//! The values of a parameter set converted ahead of its execution, see ParameterDescriptor::PreconvertParamSet
+struct PreconvertedParamSet {
+	idx_t set_idx = 0;
+	vector<Value> values;
+	//! Length of each SQL_NTS string, written to its indicator when the set is used, SQL_NTS for the other parameters
+	vector<SQLLEN> nts_lengths;
+};
+
 class ParameterDescriptor {
 public:
 	explicit ParameterDescriptor(OdbcHandleStmt *stmt_ptr);
@@ -18,6 +26,14 @@ public:
 	void ResetCurrentAPD();
 
 	SQLRETURN GetParamValues(vector<Value> &values);
+	//! Index of the parameter set the next GetParamValues converts
+	idx_t GetParamSetIndex();
+	//! Converts the parameter set set_idx without writing the descriptors, the application buffers or the diagnostics
+	//! of the statement, so it can run on another thread while the previous set executes. Returns false when the set
+	//! needs data at execution or cannot be converted, GetParamValues then converts it and reports why.
+	bool PreconvertParamSet(idx_t set_idx, PreconvertedParamSet &set);
+	//! Same as GetParamValues, with the values of the next parameter set converted by PreconvertParamSet
+	SQLRETURN UsePreconvertedParamSet(PreconvertedParamSet &set, vector<Value> &values);
 	void SetParamProcessedPtr(SQLULEN *value_ptr);
 	SQLULEN *GetParamProcessedPtr();
 	void SetArrayStatusPtr(SQLUSMALLINT *value_ptr);
@@ -28,6 +44,9 @@ public:
 	SQLRETURN GetNextParam(SQLPOINTER *param);
 	SQLRETURN PutData(SQLPOINTER data_ptr, SQLLEN str_len_or_ind_ptr);
 	bool HasParamSetToProcess();
+	//! Type of the values made for the parameter, from its IPD SQL type and its APD C type. Returns false when the
+	//! parameter has no declared type or one the driver cannot convert.
+	bool GetDeclaredType(idx_t rec_idx, LogicalType &type);
 
 public:
 	// implicitly allocated descriptors
@@ -37,6 +56,9 @@ public:
 private:
 	SQLRETURN SetValue(idx_t rec_idx);
 	void SetValue(Value &value, idx_t val_idx);
+	//! Converts the parameter rec_idx of the set val_idx, nts_length receives the length of a SQL_NTS string
+	SQLRETURN ConvertValue(idx_t rec_idx, idx_t val_idx, Value &value, SQLLEN &nts_length);
+	void SetNTSLength(idx_t rec_idx, idx_t val_idx, SQLLEN nts_length);
 	Value GetNextValue(idx_t val_idx);
 	SQLRETURN SetParamIndex();
 	SQLRETURN PutCharData(DescRecord &apd_record, DescRecord &ipd_record, SQLPOINTER data_ptr,
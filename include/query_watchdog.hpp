@@ -0,0 +1,68 @@
+#ifndef QUERY_WATCHDOG_HPP
+#define QUERY_WATCHDOG_HPP
+
+#include "duckdb_odbc.hpp"
+
+#include "duckdb/common/mutex.hpp"
+#include "duckdb/common/unordered_map.hpp"
+
+#include <chrono>
+#include <condition_variable>
+#include <thread>
+
+namespace duckdb {
+
+//! Driver-wide timer wheel that interrupts the queries running past SQL_ATTR_QUERY_TIMEOUT. A single thread serves
+//! all statements, it is started by the first armed timer and sleeps while no timer is armed.
+class QueryWatchdog {
+public:
+	static constexpr idx_t TICK_MILLISECONDS = 100;
+	//! One turn of the wheel covers WHEEL_SLOTS ticks, longer timeouts wait for several turns
+	static constexpr idx_t WHEEL_SLOTS = 256;
+
+	~QueryWatchdog();
+
+	static QueryWatchdog &Get();
+
+	//! Interrupts the context when the timer is not disarmed within the timeout, returns the timer id
+	idx_t Arm(shared_ptr<ClientContext> context, SQLULEN timeout_seconds);
+	//! Cancels the timer, returns true when it has fired already
+	bool Disarm(idx_t timer_id);
+
+private:
+	struct Timer {
+		shared_ptr<ClientContext> context;
+		//! Remaining turns of the wheel before the timer fires
+		idx_t rounds;
+		bool fired = false;
+	};
+
+	void Run();
+
+private:
+	mutex lock;
+	std::condition_variable timers_armed;
+	std::thread thread;
+	bool stop = false;
+
+	unordered_map<idx_t, Timer> timers;
+	vector<vector<idx_t>> wheel;
+	idx_t current_slot = 0;
+	idx_t next_timer_id = 1;
+};
+
+//! Arms the watchdog for the duration of a statement execution, it does nothing when the statement has no timeout
+class QueryTimeoutGuard {
+public:
+	explicit QueryTimeoutGuard(OdbcHandleStmt &hstmt);
+	~QueryTimeoutGuard();
+
+	//! Replaces the outcome of a call interrupted by the watchdog with HYT00 and frees its partial result
+	SQLRETURN Finish(OdbcHandleStmt &hstmt, SQLRETURN ret);
+
+private:
+	idx_t timer_id = 0;
+};
+
+} // namespace duckdb
+#endif // QUERY_WATCHDOG_HPP
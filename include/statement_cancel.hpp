@@ -0,0 +1,25 @@
+#ifndef STATEMENT_CANCEL_HPP
+#define STATEMENT_CANCEL_HPP
+
+#include "duckdb_odbc.hpp"
+
+namespace duckdb {
+
+//! Marks the statement as the one running on its connection for the duration of a blocking ODBC call, so that
+//! SQLCancel from another thread interrupts it and only it
+class StatementCancelScope {
+public:
+	explicit StatementCancelScope(OdbcHandleStmt &hstmt);
+	~StatementCancelScope();
+
+	//! Replaces the outcome of a canceled call with HY008 and frees its partial result
+	SQLRETURN Finish(SQLRETURN ret);
+
+private:
+	OdbcHandleStmt &hstmt;
+	OdbcHandleStmt *previous_stmt;
+	bool canceled = false;
+};
+
+} // namespace duckdb
+#endif // STATEMENT_CANCEL_HPP
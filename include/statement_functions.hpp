@@ -9,8 +9,15 @@ namespace duckdb {
 
 void PrepareQuery(OdbcHandleStmt *hstmt);
 
+//! Returns HY010 while another statement of the connection has an asynchronous execution in progress
+SQLRETURN CheckNoAsyncExecution(OdbcHandleStmt *hstmt, const string &component);
+
 SQLRETURN FinalizeStmt(OdbcHandleStmt *hstmt);
 
+//! Describes the result columns of a query prepared without all its parameter types from the types declared in the
+//! IPD, before the query is executed. The columns are left empty when a declared type is missing or binding fails.
+void DescribeStmt(OdbcHandleStmt *hstmt);
+
 SQLRETURN BatchExecuteStmt(OdbcHandleStmt *hstmt);
 SQLRETURN SingleExecuteStmt(OdbcHandleStmt *hstmt);
 
@@ -28,5 +35,8 @@ SQLRETURN BindParameterStmt(OdbcHandleStmt *hstmt, SQLUSMALLINT parameter_number
                             SQLLEN *str_len_or_ind_ptr);
 
 SQLRETURN CloseStmt(OdbcHandleStmt *hstmt);
+
+//! Inserts the rowset bound to a single-table cursor into the table, see SQLBulkOperations(SQL_ADD)
+SQLRETURN BulkAddStmt(OdbcHandleStmt *hstmt);
 } // namespace duckdb
 #endif
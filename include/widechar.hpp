@@ -12,6 +12,10 @@ namespace widechar {
 DUCKDB_API std::vector<SQLCHAR> utf16_to_utf8_lenient(const SQLWCHAR *in_buf, size_t in_buf_len,
                                            const SQLWCHAR **first_invalid_char = nullptr);
 
+//! Converts UTF-16 to UTF-8 in a single pass, replacing invalid surrogates. With SQL_NTS the length is found
+//! in the same scan. Returns the number of UTF-16 code units read, excluding the terminator
+DUCKDB_API size_t utf16_to_utf8(const SQLWCHAR *in_buf, SQLLEN in_buf_len, std::string &out);
+
 DUCKDB_API std::vector<SQLWCHAR> utf8_to_utf16_lenient(const SQLCHAR *in_buf, size_t in_buf_len,
                                                        const SQLCHAR **first_invalid_char = nullptr);
 
@@ -1,7 +1,9 @@
+#include "connection_pool.hpp"
 #include "driver.hpp"
 #include "parameter_descriptor.hpp"
 #include "row_descriptor.hpp"
 #include "handle_functions.hpp"
+#include "odbc_attributes.hpp"
 #include "odbc_diagnostic.hpp"
 #include "odbc_fetch.hpp"
 #include "odbc_utils.hpp"
@@ -52,8 +54,8 @@ SQLRETURN SQL_API SQLGetEnvAttr(SQLHENV environment_handle, SQLINTEGER attribute
 		*static_cast<SQLINTEGER *>(value_ptr) = env->output_nts;
 		break;
 	case SQL_ATTR_CP_MATCH:
-		return duckdb::SetDiagnosticRecord(env, SQL_SUCCESS_WITH_INFO, "SQLGetEnvAttr",
-		                                   "Optional feature not implemented.", SQLStateType::ST_HYC00, "");
+		*static_cast<SQLUINTEGER *>(value_ptr) = env->cp_match;
+		break;
 	}
 	return SQL_SUCCESS;
 }
@@ -116,9 +118,19 @@ SQLRETURN SQL_API SQLSetEnvAttr(SQLHENV environment_handle, SQLINTEGER attribute
 			                                   SQLStateType::ST_HY092, "");
 		}
 	}
-	case SQL_ATTR_CP_MATCH:
-		return duckdb::SetDiagnosticRecord(env, SQL_SUCCESS_WITH_INFO, "SQLSetConnectAttr",
-		                                   "Optional feature not implemented.", SQLStateType::ST_HY092, "");
+	case SQL_ATTR_CP_MATCH: {
+		auto cp_match = static_cast<SQLUINTEGER>(reinterpret_cast<uintptr_t>(value_ptr));
+		switch (cp_match) {
+		case SQL_CP_STRICT_MATCH:
+		case SQL_CP_RELAXED_MATCH:
+			env->cp_match = cp_match;
+			return SQL_SUCCESS;
+		default:
+			return duckdb::SetDiagnosticRecord(env, SQL_SUCCESS_WITH_INFO, "SQLSetConnectAttr",
+			                                   "Connection pool match not supported: " + std::to_string(cp_match),
+			                                   SQLStateType::ST_HY092, "");
+		}
+	}
 	case SQL_ATTR_OUTPUT_NTS: /* SQLINTEGER */ {
 		auto output_nts = static_cast<SQLINTEGER>(reinterpret_cast<intptr_t>(value_ptr));
 		if (output_nts == SQL_TRUE) {
@@ -220,10 +232,8 @@ static SQLRETURN GetConnectAttrInternal(SQLHDBC connection_handle, SQLINTEGER at
 #ifdef SQL_ATTR_ASYNC_DBC_PCONTEXT
 	case SQL_ATTR_ASYNC_DBC_PCONTEXT:
 #endif
-	case SQL_ATTR_ASYNC_ENABLE:
 	case SQL_ATTR_AUTO_IPD:
 	case SQL_ATTR_CONNECTION_DEAD:
-	case SQL_ATTR_CONNECTION_TIMEOUT:
 #ifdef SQL_ATTR_DBC_INFO_TOKEN
 	case SQL_ATTR_DBC_INFO_TOKEN:
 #endif
@@ -238,6 +248,15 @@ static SQLRETURN GetConnectAttrInternal(SQLHDBC connection_handle, SQLINTEGER at
 	case SQL_ATTR_TRANSLATE_LIB:
 	case SQL_ATTR_TRANSLATE_OPTION:
 		return SQL_NO_DATA;
+	case SQL_ATTR_ASYNC_ENABLE: {
+		duckdb::OdbcUtils::StoreWithLength<SQLULEN, SQLINTEGER>(dbc->async_enable, value_ptr, string_length_ptr);
+		return SQL_SUCCESS;
+	}
+	case SQL_ATTR_CONNECTION_TIMEOUT: {
+		duckdb::OdbcUtils::StoreWithLength<SQLUINTEGER, SQLINTEGER>(dbc->connection_timeout, value_ptr,
+		                                                            string_length_ptr);
+		return SQL_SUCCESS;
+	}
 	case SQL_ATTR_QUERY_TIMEOUT: {
 		duckdb::OdbcUtils::StoreWithLength<SQLINTEGER, SQLINTEGER>(0, value_ptr, string_length_ptr);
 		return SQL_SUCCESS;
@@ -246,6 +265,16 @@ static SQLRETURN GetConnectAttrInternal(SQLHDBC connection_handle, SQLINTEGER at
 		duckdb::OdbcUtils::StoreWithLength<SQLUINTEGER, SQLINTEGER>(SQL_TXN_SERIALIZABLE, value_ptr, string_length_ptr);
 		return SQL_SUCCESS;
 	}
+	case SQL_ATTR_DUCKDB_POOL_HITS:
+	case SQL_ATTR_DUCKDB_POOL_MISSES:
+	case SQL_ATTR_DUCKDB_POOL_IDLE: {
+		auto metrics = duckdb::ConnectionPool::Get().GetMetrics();
+		auto value = attribute == SQL_ATTR_DUCKDB_POOL_HITS     ? metrics.hits
+		             : attribute == SQL_ATTR_DUCKDB_POOL_MISSES ? metrics.misses
+		                                                        : metrics.idle;
+		duckdb::OdbcUtils::StoreWithLength<SQLUBIGINT, SQLINTEGER>(value, value_ptr, string_length_ptr);
+		return SQL_SUCCESS;
+	}
 	default:
 		return duckdb::SetDiagnosticRecord(dbc, SQL_ERROR, "SQLGetConnectAttr", "Attribute not supported.",
 		                                   SQLStateType::ST_HY092, dbc->GetDataSourceName());
@@ -315,6 +344,11 @@ static SQLRETURN SetConnectAttrInternal(SQLHDBC connection_handle, SQLINTEGER at
 	case SQL_ATTR_AUTOCOMMIT:
 		switch ((ptrdiff_t)value_ptr) {
 		case (ptrdiff_t)SQL_AUTOCOMMIT_ON:
+			// switching autocommit on commits the open transaction
+			ret = dbc->FlushInsertBatch(dbc);
+			if (ret != SQL_SUCCESS) {
+				return ret;
+			}
 			dbc->autocommit = true;
 			dbc->conn->SetAutoCommit(true);
 			return SQL_SUCCESS;
@@ -354,17 +388,31 @@ static SQLRETURN SetConnectAttrInternal(SQLHDBC connection_handle, SQLINTEGER at
 #ifdef SQL_ATTR_ASYNC_DBC_PCONTEXT
 	case SQL_ATTR_ASYNC_DBC_PCONTEXT:
 #endif
-	case SQL_ATTR_ASYNC_ENABLE: {
+	{
 		return duckdb::SetDiagnosticRecord(dbc, SQL_ERROR, "SQLSetConnectAttr",
 		                                   "DuckDB does not support asynchronous events.", SQLStateType::ST_HY024,
 		                                   dbc->GetDataSourceName());
 	}
+	case SQL_ATTR_ASYNC_ENABLE: {
+		SQLULEN async_enable = (SQLULEN)(uintptr_t)value_ptr;
+		if (async_enable != SQL_ASYNC_ENABLE_OFF && async_enable != SQL_ASYNC_ENABLE_ON) {
+			return duckdb::SetDiagnosticRecord(dbc, SQL_ERROR, "SQLSetConnectAttr", "Invalid attribute value.",
+			                                   SQLStateType::ST_HY024, dbc->GetDataSourceName());
+		}
+		// with SQL_AM_STATEMENT the connection attribute applies to all of its statements
+		dbc->async_enable = async_enable;
+		for (auto stmt : dbc->vec_stmt_ref) {
+			stmt->async_enable = async_enable;
+		}
+		return SQL_SUCCESS;
+	}
 	case SQL_ATTR_AUTO_IPD:
 	case SQL_ATTR_CONNECTION_DEAD: {
 		return duckdb::SetDiagnosticRecord(dbc, SQL_ERROR, "SQLSetConnectAttr", "Read-only attribute.",
 		                                   SQLStateType::ST_HY092, dbc->GetDataSourceName());
 	}
 	case SQL_ATTR_CONNECTION_TIMEOUT:
+		dbc->connection_timeout = OdbcUtils::SQLPointerToSQLUInteger(value_ptr);
 		return SQL_SUCCESS;
 	case SQL_ATTR_CURRENT_CATALOG: {
 		if (dbc->conn) {
@@ -523,7 +571,7 @@ static SQLRETURN GetStmtAttrInternal(SQLHSTMT statement_handle, SQLINTEGER attri
 		return SQL_SUCCESS;
 	}
 	case SQL_ATTR_QUERY_TIMEOUT: {
-		*((SQLINTEGER *)value_ptr) = 0;
+		*((SQLULEN *)value_ptr) = hstmt->query_timeout;
 		return SQL_SUCCESS;
 	}
 	case SQL_ATTR_RETRIEVE_DATA: {
@@ -538,7 +586,10 @@ static SQLRETURN GetStmtAttrInternal(SQLHSTMT statement_handle, SQLINTEGER attri
 		*((SQLULEN *)value_ptr) = hstmt->client_attrs.max_len;
 		return SQL_SUCCESS;
 	}
-	case SQL_ATTR_ASYNC_ENABLE:
+	case SQL_ATTR_ASYNC_ENABLE: {
+		*((SQLULEN *)value_ptr) = hstmt->async_enable;
+		return SQL_SUCCESS;
+	}
 #ifdef SQL_ATTR_ASYNC_STMT_EVENT
 	case SQL_ATTR_ASYNC_STMT_EVENT:
 #endif
@@ -674,6 +725,7 @@ static SQLRETURN SetStmtAttrInternal(SQLHSTMT statement_handle, SQLINTEGER attri
 		return SQL_SUCCESS;
 	}
 	case SQL_ATTR_QUERY_TIMEOUT:
+		hstmt->query_timeout = (SQLULEN)(uintptr_t)value_ptr;
 		return SQL_SUCCESS;
 	case SQL_ATTR_RETRIEVE_DATA: {
 		SQLULEN value = (SQLULEN)(uintptr_t)value_ptr;
@@ -711,6 +763,21 @@ static SQLRETURN SetStmtAttrInternal(SQLHSTMT statement_handle, SQLINTEGER attri
 		hstmt->client_attrs.max_len = (SQLULEN)(uintptr_t)value_ptr;
 		return SQL_SUCCESS;
 	}
+	case SQL_ATTR_ASYNC_ENABLE: {
+		SQLULEN value = (SQLULEN)(uintptr_t)value_ptr;
+		if (value != SQL_ASYNC_ENABLE_OFF && value != SQL_ASYNC_ENABLE_ON) {
+			return duckdb::SetDiagnosticRecord(hstmt, SQL_ERROR, "SQLSetStmtAttr",
+			                                   "Invalid attribute value:" + std::to_string(attribute),
+			                                   SQLStateType::ST_HY024, hstmt->dbc->GetDataSourceName());
+		}
+		if (hstmt->pending) {
+			return duckdb::SetDiagnosticRecord(hstmt, SQL_ERROR, "SQLSetStmtAttr",
+			                                   "The asynchronous execution is still in progress",
+			                                   SQLStateType::ST_HY010, hstmt->dbc->GetDataSourceName());
+		}
+		hstmt->async_enable = value;
+		return SQL_SUCCESS;
+	}
 	default:
 		return duckdb::SetDiagnosticRecord(hstmt, SQL_SUCCESS_WITH_INFO, "SQLSetStmtAttr",
 		                                   "Option value changed:" + std::to_string(attribute), SQLStateType::ST_01S02,
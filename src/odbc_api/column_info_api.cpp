@@ -4,6 +4,7 @@
 #include "widechar.hpp"
 #include "odbc_diagnostic.hpp"
 #include "row_descriptor.hpp"
+#include "statement_functions.hpp"
 
 #include "duckdb/main/prepared_statement_data.hpp"
 
@@ -74,6 +75,7 @@ static SQLRETURN DescribeColInternal(SQLHSTMT statement_handle, SQLUSMALLINT col
 	if (ret != SQL_SUCCESS) {
 		return ret;
 	}
+	duckdb::DescribeStmt(hstmt);
 
 	if (column_number > hstmt->stmt->ColumnCount()) {
 		return SQL_ERROR;
@@ -159,6 +161,7 @@ static SQLRETURN ColAttributeInternal(SQLHSTMT statement_handle, SQLUSMALLINT co
 	if (ret != SQL_SUCCESS) {
 		return ret;
 	}
+	duckdb::DescribeStmt(hstmt);
 
 	if (field_identifier != SQL_DESC_COUNT && hstmt->res &&
 	    hstmt->res->properties.return_type != duckdb::StatementReturnType::QUERY_RESULT) {
@@ -188,7 +191,7 @@ static SQLRETURN ColAttributeInternal(SQLHSTMT statement_handle, SQLUSMALLINT co
 		                                   hstmt->dbc->GetDataSourceName());
 	}
 	case SQL_DESC_BASE_COLUMN_NAME:
-		return WriteStringCol("SQLColAttribute(s)", hstmt, desc_record->sql_desc_base_column_name,
+		return WriteStringCol("SQLColAttribute(s)", hstmt, desc_record->GetBaseColumnName(),
 		                      reinterpret_cast<CHAR_TYPE *>(character_attribute_ptr), buffer_length, string_length_ptr);
 	case SQL_DESC_TABLE_NAME:
 	case SQL_DESC_BASE_TABLE_NAME: {
@@ -219,7 +222,7 @@ static SQLRETURN ColAttributeInternal(SQLHSTMT statement_handle, SQLUSMALLINT co
 	case SQL_DESC_FIXED_PREC_SCALE:
 		return SetNumericAttributePtr(hstmt, desc_record->sql_desc_fixed_prec_scale, numeric_attribute_ptr);
 	case SQL_DESC_LABEL:
-		return WriteStringCol("SQLColAttribute(s)", hstmt, desc_record->sql_desc_label,
+		return WriteStringCol("SQLColAttribute(s)", hstmt, desc_record->GetLabel(),
 		                      reinterpret_cast<CHAR_TYPE *>(character_attribute_ptr), buffer_length, string_length_ptr);
 	case SQL_COLUMN_LENGTH:
 	case SQL_DESC_LENGTH:
@@ -339,6 +342,7 @@ SQLRETURN SQL_API SQLNumResultCols(SQLHSTMT statement_handle, SQLSMALLINT *colum
 	if (ret != SQL_SUCCESS) {
 		return ret;
 	}
+	duckdb::DescribeStmt(hstmt);
 
 	if (!column_count_ptr) {
 		return SQL_ERROR;
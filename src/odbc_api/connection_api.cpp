@@ -1,6 +1,8 @@
 #include "connect.hpp"
 
+#include "connection_pool.hpp"
 #include "duckdb_odbc.hpp"
+#include "instance_keep_alive.hpp"
 #include "odbc_utils.hpp"
 #include "widechar.hpp"
 
@@ -153,6 +155,18 @@ SQLRETURN SQL_API SQLDisconnect(SQLHDBC connection_handle) {
 		return ret;
 	}
 
-	dbc->conn.reset();
+	ret = dbc->FlushInsertBatch(dbc);
+	if (ret != SQL_SUCCESS) {
+		return ret;
+	}
+
+	if (!dbc->pool_key.empty()) {
+		duckdb::ConnectionPool::Get().Release(*dbc);
+	} else {
+		dbc->conn.reset();
+	}
+	dbc->db.reset();
+	// the database may have lost its last connection
+	duckdb::InstanceKeepAlive::Get().Sweep();
 	return SQL_SUCCESS;
 }
@@ -19,3 +19,25 @@ SQLRETURN SQL_API SQLCloseCursor(SQLHSTMT statement_handle) {
 
 	return duckdb::CloseStmt(hstmt);
 }
+
+//===--------------------------------------------------------------------===//
+// SQLBulkOperations
+//===--------------------------------------------------------------------===//
+
+/**
+ * <a
+ * href="https://learn.microsoft.com/en-us/sql/odbc/reference/syntax/sqlbulkoperations-function?view=sql-server-ver16">Docs</a>
+ */
+SQLRETURN SQL_API SQLBulkOperations(SQLHSTMT statement_handle, SQLSMALLINT operation) {
+	duckdb::OdbcHandleStmt *hstmt = nullptr;
+	SQLRETURN ret = ConvertHSTMTResult(statement_handle, hstmt);
+	if (ret != SQL_SUCCESS) {
+		return ret;
+	}
+
+	if (operation != SQL_ADD) {
+		return duckdb::SetDiagnosticRecord(hstmt, SQL_ERROR, "SQLBulkOperations", "Only SQL_ADD is supported",
+		                                   duckdb::SQLStateType::ST_HYC00, hstmt->dbc->GetDataSourceName());
+	}
+	return duckdb::BulkAddStmt(hstmt);
+}
@@ -149,7 +149,7 @@ static SQLRETURN GetDescFieldInternal(SQLHDESC descriptor_handle, SQLSMALLINT re
 		if (!desc->IsIRD()) {
 			return desc->ReturnInvalidFieldIdentifier(false);
 		}
-		return WriteStringDesc("SQLGetDescField", desc, desc->records[rec_idx].sql_desc_base_column_name,
+		return WriteStringDesc("SQLGetDescField", desc, desc->records[rec_idx].GetBaseColumnName(),
 		                       reinterpret_cast<CHAR_TYPE *>(value_ptr), buffer_length, string_length_ptr);
 	}
 	case SQL_DESC_BASE_TABLE_NAME: {
@@ -223,7 +223,7 @@ static SQLRETURN GetDescFieldInternal(SQLHDESC descriptor_handle, SQLSMALLINT re
 		if (!desc->IsIRD()) {
 			return desc->ReturnInvalidFieldIdentifier(false);
 		}
-		return WriteStringDesc("SQLGetDescField", desc, desc->records[rec_idx].sql_desc_label,
+		return WriteStringDesc("SQLGetDescField", desc, desc->records[rec_idx].GetLabel(),
 		                       reinterpret_cast<CHAR_TYPE *>(value_ptr), buffer_length, string_length_ptr);
 	}
 	case SQL_DESC_LENGTH: {
@@ -10,117 +10,6 @@
 // Functions returning valid empty result sets (i.e., SELECT ... WHERE 1 < 0)
 // ============================================================================
 
-//===--------------------------------------------------------------------===//
-// SQLPrimaryKeys and SQLPrimaryKeysW
-// If implemented, move to src/odbc_api/metadata_api.cpp
-//===--------------------------------------------------------------------===//
-
-static SQLRETURN PrimaryKeysInternal(SQLHSTMT statement_handle, SQLCHAR *catalog_name, SQLSMALLINT name_length1,
-                                     SQLCHAR *schema_name, SQLSMALLINT name_length2, SQLCHAR *table_name,
-                                     SQLSMALLINT name_length3) {
-	const std::string query = R"#(
-SELECT
-	CAST('' AS VARCHAR) AS "TABLE_CAT",
-	CAST('' AS VARCHAR) AS "TABLE_SCHEM",
-	CAST('' AS VARCHAR) AS "TABLE_NAME",
-	CAST('' AS VARCHAR) AS "COLUMN_NAME",
-	CAST(0 AS SMALLINT) AS "KEY_SEQ",
-	CAST('' AS VARCHAR) AS "PK_NAME"
-WHERE 1 < 0
-)#";
-	duckdb::OdbcHandleStmt *stmt = nullptr;
-	const SQLRETURN ret = ConvertHSTMT(statement_handle, stmt);
-	if (ret != SQL_SUCCESS) {
-		return ret;
-	}
-
-	return duckdb::ExecDirectStmt(stmt, query);
-}
-
-SQLRETURN SQL_API SQLPrimaryKeys(SQLHSTMT statement_handle, SQLCHAR *catalog_name, SQLSMALLINT name_length1,
-                                 SQLCHAR *schema_name, SQLSMALLINT name_length2, SQLCHAR *table_name,
-                                 SQLSMALLINT name_length3) {
-	return PrimaryKeysInternal(statement_handle, catalog_name, name_length1, schema_name, name_length2, table_name,
-	                           name_length3);
-}
-
-SQLRETURN SQL_API SQLPrimaryKeysW(SQLHSTMT statement_handle, SQLWCHAR *catalog_name, SQLSMALLINT name_length1,
-                                  SQLWCHAR *schema_name, SQLSMALLINT name_length2, SQLWCHAR *table_name,
-                                  SQLSMALLINT name_length3) {
-	auto catalog_name_conv = duckdb::widechar::utf16_conv(catalog_name, name_length1);
-	auto schema_name_conv = duckdb::widechar::utf16_conv(schema_name, name_length2);
-	auto table_name_conv = duckdb::widechar::utf16_conv(table_name, name_length3);
-	return PrimaryKeysInternal(statement_handle, catalog_name_conv.utf8_str, catalog_name_conv.utf8_len_smallint(),
-	                           schema_name_conv.utf8_str, schema_name_conv.utf8_len_smallint(),
-	                           table_name_conv.utf8_str, table_name_conv.utf8_len_smallint());
-}
-
-//===--------------------------------------------------------------------===//
-// SQLForeignKeys and SQLForeignKeysW
-// If implemented, move to src/odbc_api/metadata_api.cpp
-//===--------------------------------------------------------------------===//
-
-static SQLRETURN ForeignKeysInternal(SQLHSTMT statement_handle, SQLCHAR *pk_catalog_name, SQLSMALLINT name_length1,
-                                     SQLCHAR *pk_schema_name, SQLSMALLINT name_length2, SQLCHAR *pk_table_name,
-                                     SQLSMALLINT name_length3, SQLCHAR *fk_catalog_name, SQLSMALLINT name_length4,
-                                     SQLCHAR *fk_schema_name, SQLSMALLINT name_length5, SQLCHAR *fk_table_name,
-                                     SQLSMALLINT name_length6) {
-	const std::string query = R"#(
-SELECT
-	CAST('' AS VARCHAR) AS "PKTABLE_CAT",
-	CAST('' AS VARCHAR) AS "PKTABLE_SCHEM",
-	CAST('' AS VARCHAR) AS "PKTABLE_NAME",
-	CAST('' AS VARCHAR) AS "PKCOLUMN_NAME",
-	CAST('' AS VARCHAR) AS "FKTABLE_CAT",
-	CAST('' AS VARCHAR) AS "FKTABLE_SCHEM",
-	CAST('' AS VARCHAR) AS "FKTABLE_NAME",
-	CAST('' AS VARCHAR) AS "FKCOLUMN_NAME",
-	CAST(0 AS SMALLINT) AS "KEY_SEQ",
-	CAST(0 AS SMALLINT) AS "UPDATE_RULE",
-	CAST(0 AS SMALLINT) AS "DELETE_RULE",
-	CAST('' AS VARCHAR) AS "FK_NAME",
-	CAST('' AS VARCHAR) AS "PK_NAME",
-	CAST(0 AS SMALLINT) AS "DEFERRABILITY"
-WHERE 1 < 0
-)#";
-	duckdb::OdbcHandleStmt *stmt = nullptr;
-	const SQLRETURN ret = ConvertHSTMT(statement_handle, stmt);
-	if (ret != SQL_SUCCESS) {
-		return ret;
-	}
-
-	return duckdb::ExecDirectStmt(stmt, query);
-}
-
-SQLRETURN SQL_API SQLForeignKeys(SQLHSTMT statement_handle, SQLCHAR *pk_catalog_name, SQLSMALLINT name_length1,
-                                 SQLCHAR *pk_schema_name, SQLSMALLINT name_length2, SQLCHAR *pk_table_name,
-                                 SQLSMALLINT name_length3, SQLCHAR *fk_catalog_name, SQLSMALLINT name_length4,
-                                 SQLCHAR *fk_schema_name, SQLSMALLINT name_length5, SQLCHAR *fk_table_name,
-                                 SQLSMALLINT name_length6) {
-	return ForeignKeysInternal(statement_handle, pk_catalog_name, name_length1, pk_schema_name, name_length2,
-	                           pk_table_name, name_length3, fk_catalog_name, name_length4, fk_schema_name, name_length5,
-	                           fk_table_name, name_length6);
-}
-
-SQLRETURN SQL_API SQLForeignKeysW(SQLHSTMT statement_handle, SQLWCHAR *pk_catalog_name, SQLSMALLINT name_length1,
-                                  SQLWCHAR *pk_schema_name, SQLSMALLINT name_length2, SQLWCHAR *pk_table_name,
-                                  SQLSMALLINT name_length3, SQLWCHAR *fk_catalog_name, SQLSMALLINT name_length4,
-                                  SQLWCHAR *fk_schema_name, SQLSMALLINT name_length5, SQLWCHAR *fk_table_name,
-                                  SQLSMALLINT name_length6) {
-	auto pk_catalog_name_conv = duckdb::widechar::utf16_conv(pk_catalog_name, name_length1);
-	auto pk_schema_name_conv = duckdb::widechar::utf16_conv(pk_schema_name, name_length2);
-	auto pk_table_name_conv = duckdb::widechar::utf16_conv(pk_table_name, name_length3);
-	auto fk_catalog_name_conv = duckdb::widechar::utf16_conv(fk_catalog_name, name_length4);
-	auto fk_schema_name_conv = duckdb::widechar::utf16_conv(fk_schema_name, name_length5);
-	auto fk_table_name_conv = duckdb::widechar::utf16_conv(fk_table_name, name_length6);
-	return ForeignKeysInternal(
-	    statement_handle, pk_catalog_name_conv.utf8_str, pk_catalog_name_conv.utf8_len_smallint(),
-	    pk_schema_name_conv.utf8_str, pk_schema_name_conv.utf8_len_smallint(), pk_table_name_conv.utf8_str,
-	    pk_table_name_conv.utf8_len_smallint(), fk_catalog_name_conv.utf8_str, fk_catalog_name_conv.utf8_len_smallint(),
-	    fk_schema_name_conv.utf8_str, fk_schema_name_conv.utf8_len_smallint(), fk_table_name_conv.utf8_str,
-	    fk_table_name_conv.utf8_len_smallint());
-}
-
 //===--------------------------------------------------------------------===//
 // SQLProcedureColumns and SQLProcedureColumnsW
 // If implemented, move to src/odbc_api/metadata_api.cpp
@@ -374,58 +263,6 @@ SQLRETURN SQL_API SQLSpecialColumnsW(SQLHSTMT statement_handle, SQLUSMALLINT ide
 	                              table_name_conv.utf8_len_smallint(), scope, nullable);
 }
 
-//===--------------------------------------------------------------------===//
-// SQLStatistics and SQLStatisticsW
-// If implemented, move to src/odbc_api/metadata_api.cpp
-//===--------------------------------------------------------------------===//
-
-static SQLRETURN StatisticsInternal(SQLHSTMT statement_handle, SQLCHAR *catalog_name, SQLSMALLINT name_length1,
-                                    SQLCHAR *schema_name, SQLSMALLINT name_length2, SQLCHAR *table_name,
-                                    SQLSMALLINT name_length3, SQLUSMALLINT unique, SQLUSMALLINT reserved) {
-	std::string query = R"#(
-SELECT
-	CAST('' AS VARCHAR ) AS "TABLE_CAT",
-	CAST('' AS VARCHAR ) AS "TABLE_SCHEM",
-	CAST('' AS VARCHAR ) AS "TABLE_NAME",
-	CAST(0  AS SMALLINT) AS "NON_UNIQUE",
-	CAST('' AS VARCHAR ) AS "INDEX_QUALIFIER",
-	CAST('' AS VARCHAR ) AS "INDEX_NAME",
-	CAST(0  AS SMALLINT) AS "TYPE",
-	CAST(0  AS SMALLINT) AS "ORDINAL_POSITION",
-	CAST('' AS VARCHAR ) AS "COLUMN_NAME",
-	CAST('' AS CHAR(1) ) AS "ASC_OR_DESC",
-	CAST(0  AS INT     ) AS "CARDINALITY",
-	CAST(0  AS INT     ) AS "PAGES",
-	CAST('' AS VARCHAR ) AS "FILTER_CONDITION"
-WHERE 1 < 0
-)#";
-	duckdb::OdbcHandleStmt *stmt = nullptr;
-	const SQLRETURN ret = ConvertHSTMT(statement_handle, stmt);
-	if (ret != SQL_SUCCESS) {
-		return ret;
-	}
-
-	return duckdb::ExecDirectStmt(stmt, query);
-}
-
-SQLRETURN SQL_API SQLStatistics(SQLHSTMT statement_handle, SQLCHAR *catalog_name, SQLSMALLINT name_length1,
-                                SQLCHAR *schema_name, SQLSMALLINT name_length2, SQLCHAR *table_name,
-                                SQLSMALLINT name_length3, SQLUSMALLINT unique, SQLUSMALLINT reserved) {
-	return StatisticsInternal(statement_handle, catalog_name, name_length1, schema_name, name_length2, table_name,
-	                          name_length3, unique, reserved);
-}
-
-SQLRETURN SQL_API SQLStatisticsW(SQLHSTMT statement_handle, SQLWCHAR *catalog_name, SQLSMALLINT name_length1,
-                                 SQLWCHAR *schema_name, SQLSMALLINT name_length2, SQLWCHAR *table_name,
-                                 SQLSMALLINT name_length3, SQLUSMALLINT unique, SQLUSMALLINT reserved) {
-	auto catalog_name_conv = duckdb::widechar::utf16_conv(catalog_name, name_length1);
-	auto schema_name_conv = duckdb::widechar::utf16_conv(schema_name, name_length2);
-	auto table_name_conv = duckdb::widechar::utf16_conv(table_name, name_length3);
-	return StatisticsInternal(statement_handle, catalog_name_conv.utf8_str, catalog_name_conv.utf8_len_smallint(),
-	                          schema_name_conv.utf8_str, schema_name_conv.utf8_len_smallint(), table_name_conv.utf8_str,
-	                          table_name_conv.utf8_len_smallint(), unique, reserved);
-}
-
 // ============================================================================
 // Functions explicitly marked as not implemented (SetNotImplemented)
 // ============================================================================
@@ -499,20 +336,6 @@ SQLRETURN SQL_API SQLBrowseConnectW(SQLHDBC connection_handle, SQLWCHAR *in_conn
 	                             out_connection_string_conv.utf8_len_smallint(), string_length2_ptr);
 }
 
-//===--------------------------------------------------------------------===//
-// SQLBulkOperations
-//===--------------------------------------------------------------------===//
-
-SQLRETURN SQL_API SQLBulkOperations(SQLHSTMT statement_handle, SQLSMALLINT operation) {
-	duckdb::OdbcHandle *hstmt;
-	const auto ret = ConvertHandle(statement_handle, hstmt);
-	if (ret != SQL_SUCCESS) {
-		return ret;
-	}
-
-	return SetNotImplemented(hstmt, "SQLBulkOperations");
-}
-
 //===--------------------------------------------------------------------===//
 // SQLSetPos
 //===--------------------------------------------------------------------===//
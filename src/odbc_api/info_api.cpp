@@ -4,11 +4,15 @@
 #include "odbc_diagnostic.hpp"
 #include "odbc_utils.hpp"
 #include "handle_functions.hpp"
+#include "metadata_cache.hpp"
 #include "statement_functions.hpp"
 #include "widechar.hpp"
 
 #include "duckdb/common/helper.hpp"
 
+#include <mutex>
+#include <unordered_map>
+
 // From ODBC Spec (ODBCVER >= 0x0300 and ODBCVER >= 0x0400)
 // https://github.com/microsoft/ODBC-Specification/blob/master/Windows/inc/sqlext.h
 // Needed for use with Power Query SDK and Power BI
@@ -143,7 +147,7 @@ static SQLRETURN GetInfoInternal(SQLHDBC connection_handle, SQLUSMALLINT info_ty
 		return SQL_SUCCESS;
 	}
 	case SQL_ASYNC_MODE: {
-		duckdb::OdbcUtils::StoreWithLength<SQLUINTEGER>(SQL_AM_NONE, info_value_ptr, string_length_ptr);
+		duckdb::OdbcUtils::StoreWithLength<SQLUINTEGER>(SQL_AM_STATEMENT, info_value_ptr, string_length_ptr);
 		return SQL_SUCCESS;
 	}
 #ifdef SQL_ASYNC_NOTIFICATION
@@ -511,7 +515,7 @@ static SQLRETURN GetInfoInternal(SQLHDBC connection_handle, SQLUSMALLINT info_ty
 		return SQL_SUCCESS;
 	}
 	case SQL_DYNAMIC_CURSOR_ATTRIBUTES1: {
-		SQLUINTEGER mask = SQL_CA1_ABSOLUTE | SQL_CA1_NEXT | SQL_CA1_RELATIVE;
+		SQLUINTEGER mask = SQL_CA1_ABSOLUTE | SQL_CA1_NEXT | SQL_CA1_RELATIVE | SQL_CA1_BULK_ADD;
 		duckdb::OdbcUtils::StoreWithLength<SQLUINTEGER>(mask, info_value_ptr, string_length_ptr);
 		return SQL_SUCCESS;
 	}
@@ -624,7 +628,11 @@ static SQLRETURN GetInfoInternal(SQLHDBC connection_handle, SQLUSMALLINT info_ty
 		return WriteStringInfo(connection_handle, yes_str, reinterpret_cast<CHAR_TYPE *>(info_value_ptr), buffer_length,
 		                       string_length_ptr);
 	}
-	case SQL_MAX_ASYNC_CONCURRENT_STATEMENTS:
+	case SQL_MAX_ASYNC_CONCURRENT_STATEMENTS: {
+		// asynchronous executions run one at a time per connection
+		duckdb::OdbcUtils::StoreWithLength<SQLUINTEGER>(1, info_value_ptr, string_length_ptr);
+		return SQL_SUCCESS;
+	}
 	case SQL_MAX_BINARY_LITERAL_LEN:
 	case SQL_MAX_CHAR_LITERAL_LEN:
 	case SQL_MAX_INDEX_SIZE:
@@ -640,7 +648,6 @@ static SQLRETURN GetInfoInternal(SQLHDBC connection_handle, SQLUSMALLINT info_ty
 	case SQL_MAX_COLUMNS_IN_ORDER_BY:
 	case SQL_MAX_COLUMNS_IN_SELECT:
 	case SQL_MAX_COLUMNS_IN_TABLE:
-	case SQL_MAX_CONCURRENT_ACTIVITIES:
 	case SQL_MAX_CURSOR_NAME_LEN:
 	case SQL_MAX_IDENTIFIER_LEN:
 	case SQL_MAX_PROCEDURE_NAME_LEN:
@@ -651,6 +658,11 @@ static SQLRETURN GetInfoInternal(SQLHDBC connection_handle, SQLUSMALLINT info_ty
 		duckdb::OdbcUtils::StoreWithLength<SQLUSMALLINT>(0, info_value_ptr, string_length_ptr);
 		return SQL_SUCCESS;
 	}
+	case SQL_MAX_CONCURRENT_ACTIVITIES: {
+		// no limit, the open result sets are spilled when another statement of the connection runs a query
+		duckdb::OdbcUtils::StoreWithLength<SQLUSMALLINT>(0, info_value_ptr, string_length_ptr);
+		return SQL_SUCCESS;
+	}
 	case SQL_MAX_DRIVER_CONNECTIONS: {
 		// Set in 1, maximum number of active connections
 		duckdb::OdbcUtils::StoreWithLength<SQLUSMALLINT>(1, info_value_ptr, string_length_ptr);
@@ -821,7 +833,7 @@ static SQLRETURN GetInfoInternal(SQLHDBC connection_handle, SQLUSMALLINT info_ty
 		return SQL_SUCCESS;
 	}
 	case SQL_STATIC_CURSOR_ATTRIBUTES1: {
-		SQLUINTEGER mask = SQL_CA1_NEXT | SQL_CA1_ABSOLUTE | SQL_CA1_RELATIVE;
+		SQLUINTEGER mask = SQL_CA1_NEXT | SQL_CA1_ABSOLUTE | SQL_CA1_RELATIVE | SQL_CA1_BULK_ADD;
 		duckdb::OdbcUtils::StoreWithLength<SQLUINTEGER>(mask, info_value_ptr, string_length_ptr);
 		return SQL_SUCCESS;
 	}
@@ -951,6 +963,44 @@ SQLRETURN SQL_API SQLGetFunctions(SQLHDBC connection_handle, SQLUSMALLINT functi
 // SQLGetTypeInfo
 //===--------------------------------------------------------------------===//
 
+//! Returns the result of SQLGetTypeInfo for the data type, it is materialized once per process for each data type
+static duckdb::shared_ptr<duckdb::CachedMetadataResult> GetTypeInfoResult(SQLSMALLINT data_type) {
+	static const vector<std::string> names {
+	    "TYPE_NAME",          "DATA_TYPE",        "COLUMN_SIZE",       "LITERAL_PREFIX",  "LITERAL_SUFFIX",
+	    "CREATE_PARAMS",      "NULLABLE",         "CASE_SENSITIVE",    "SEARCHABLE",      "UNSIGNED_ATTRIBUTE",
+	    "FIXED_PREC_SCALE",   "AUTO_UNIQUE_VALUE", "LOCAL_TYPE_NAME",  "MINIMUM_SCALE",   "MAXIMUM_SCALE",
+	    "SQL_DATA_TYPE",      "SQL_DATETIME_SUB", "NUM_PREC_RADIX",    "INTERVAL_PRECISION"};
+	static const vector<duckdb::LogicalType> types {
+	    duckdb::LogicalType::VARCHAR,  duckdb::LogicalType::SMALLINT, duckdb::LogicalType::INTEGER,
+	    duckdb::LogicalType::VARCHAR,  duckdb::LogicalType::VARCHAR,  duckdb::LogicalType::VARCHAR,
+	    duckdb::LogicalType::SMALLINT, duckdb::LogicalType::SMALLINT, duckdb::LogicalType::SMALLINT,
+	    duckdb::LogicalType::SMALLINT, duckdb::LogicalType::SMALLINT, duckdb::LogicalType::SMALLINT,
+	    duckdb::LogicalType::VARCHAR,  duckdb::LogicalType::SMALLINT, duckdb::LogicalType::SMALLINT,
+	    duckdb::LogicalType::SMALLINT, duckdb::LogicalType::SMALLINT, duckdb::LogicalType::INTEGER,
+	    duckdb::LogicalType::SMALLINT};
+	static std::mutex results_lock;
+	static std::unordered_map<SQLSMALLINT, duckdb::shared_ptr<duckdb::CachedMetadataResult>> results;
+
+	std::lock_guard<std::mutex> guard(results_lock);
+	auto &result = results[data_type];
+	if (!result) {
+		// the collection is not tied to a database instance
+		auto collection =
+		    duckdb::make_uniq<duckdb::ColumnDataCollection>(duckdb::Allocator::DefaultAllocator(), types);
+		if (data_type == SQL_ALL_TYPES) {
+			ApiInfo::WriteInfoTypesToCollection(ApiInfo::GetVectorTypesAddr(), *collection);
+		} else {
+			vector<duckdb::OdbcTypeInfo> vec_types;
+			ApiInfo::FindDataType(data_type, vec_types);
+			ApiInfo::WriteInfoTypesToCollection(vec_types, *collection);
+		}
+		result = duckdb::make_shared_ptr<duckdb::CachedMetadataResult>(
+		    std::string(), duckdb::StatementType::SELECT_STATEMENT, duckdb::StatementProperties(), names,
+		    std::move(collection));
+	}
+	return result;
+}
+
 static SQLRETURN GetTypeInfoInternal(SQLHSTMT statement_handle, SQLSMALLINT data_type) {
 	duckdb::OdbcHandleStmt *hstmt = nullptr;
 	SQLRETURN ret = ConvertHSTMT(statement_handle, hstmt);
@@ -958,43 +1008,7 @@ static SQLRETURN GetTypeInfoInternal(SQLHSTMT statement_handle, SQLSMALLINT data
 		return ret;
 	}
 
-	std::string query("SELECT * FROM (VALUES ");
-
-	if (data_type == SQL_ALL_TYPES) {
-		auto vec_types = ApiInfo::GetVectorTypesAddr();
-		ApiInfo::WriteInfoTypesToQueryString(vec_types, query);
-	} else {
-		vector<duckdb::OdbcTypeInfo> vec_types;
-		ApiInfo::FindDataType(data_type, vec_types);
-		ApiInfo::WriteInfoTypesToQueryString(vec_types, query);
-	}
-
-	// clang-format off
-	query += R"(
-	) AS odbc_types (
-		"TYPE_NAME",
-		"DATA_TYPE",
-		"COLUMN_SIZE",
-		"LITERAL_PREFIX",
-		"LITERAL_SUFFIX",
-		"CREATE_PARAMS",
-		"NULLABLE",
-		"CASE_SENSITIVE",
-		"SEARCHABLE",
-		"UNSIGNED_ATTRIBUTE",
-		"FIXED_PREC_SCALE",
-		"AUTO_UNIQUE_VALUE",
-		"LOCAL_TYPE_NAME",
-		"MINIMUM_SCALE",
-		"MAXIMUM_SCALE",
-		"SQL_DATA_TYPE",
-		"SQL_DATETIME_SUB",
-		"NUM_PREC_RADIX",
-		"INTERVAL_PRECISION"
-	))";
-	// clang-format on
-
-	return duckdb::ExecDirectStmt(hstmt, query);
+	return duckdb::ExecStaticMetadataStmt(hstmt, "SQLGetTypeInfo", GetTypeInfoResult(data_type));
 }
 
 /**
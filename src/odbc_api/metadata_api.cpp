@@ -1,5 +1,6 @@
 #include "duckdb_odbc.hpp"
 #include "api_info.hpp"
+#include "catalog_scan.hpp"
 #include "odbc_diagnostic.hpp"
 #include "odbc_utils.hpp"
 #include "statement_functions.hpp"
@@ -8,8 +9,7 @@
 
 #include "duckdb/common/constants.hpp"
 
-#include <regex>
-
+using duckdb::CatalogNameFilter;
 using duckdb::LogicalTypeId;
 using duckdb::OdbcUtils;
 using duckdb::SQLStateType;
@@ -27,92 +27,37 @@ static SQLRETURN TablesInternal(SQLHSTMT statement_handle, SQLCHAR *catalog_name
 		return ret;
 	}
 
-	// String search pattern for catalog name
 	auto catalog_n = OdbcUtils::ConvertSQLCHARToString(catalog_name, name_length1);
-	std::string catalog_filter =
-	    OdbcUtils::ParseStringFilter("\"TABLE_CAT\"", catalog_n, hstmt->dbc->sql_attr_metadata_id);
-
-	// String search pattern for schema name
 	auto schema_n = OdbcUtils::ConvertSQLCHARToString(schema_name, name_length2);
-	std::string schema_filter =
-	    OdbcUtils::ParseStringFilter("\"TABLE_SCHEM\"", schema_n, hstmt->dbc->sql_attr_metadata_id);
-
-	// String search pattern for table name
 	auto table_n = OdbcUtils::ConvertSQLCHARToString(table_name, name_length3);
-	std::string table_filter =
-	    OdbcUtils::ParseStringFilter("\"TABLE_NAME\"", table_n, hstmt->dbc->sql_attr_metadata_id);
 
 	// Table types
 	auto table_tp = OdbcUtils::ConvertSQLCHARToString(table_type, name_length4);
 
-	std::string tables_query;
-
 	// Note, Excel violates the special cases spec by passing CatalogName=SQL_ALL_CATALOGS and TableType="TABLE,VIEW" to
 	// list tables, so we also check for empty TableType below.
 	if (catalog_n == std::string(SQL_ALL_CATALOGS) && schema_n.empty() && table_n.empty() && table_tp.empty()) {
 		// If CatalogName is SQL_ALL_CATALOGS and SchemaName and TableName are empty strings, the result set contains a
 		// list of valid catalogs for the data source. (All columns except the TABLE_CAT column contain NULLs.)
-		tables_query = R"#(
-SELECT DISTINCT
-	CAST(catalog_name AS VARCHAR) AS "TABLE_CAT",
-	CAST(NULL         AS VARCHAR) AS "TABLE_SCHEM",
-	CAST(NULL         AS VARCHAR) AS "TABLE_NAME",
-	CAST(NULL         AS VARCHAR) AS "TABLE_TYPE",
-	CAST(NULL         AS VARCHAR) AS "REMARKS"
-FROM information_schema.schemata
-WHERE catalog_name NOT IN (
-	'system',
-	'temp')
-AND catalog_name NOT LIKE '__ducklake_%'
-ORDER BY "TABLE_CAT"
-)#";
-	} else if (schema_n == std::string(SQL_ALL_SCHEMAS) && catalog_n.empty() && table_n.empty() && table_tp.empty()) {
+		return duckdb::CatalogListStmt(hstmt, duckdb::CatalogListType::CATALOGS);
+	}
+	if (schema_n == std::string(SQL_ALL_SCHEMAS) && catalog_n.empty() && table_n.empty() && table_tp.empty()) {
 		// If SchemaName is SQL_ALL_SCHEMAS and CatalogName and TableName are empty strings, the result set contains a
 		// list of valid schemas for the data source. (All columns except the TABLE_SCHEM column contain NULLs.)
-		tables_query = R"#(
-SELECT
-	CAST(NULL        AS VARCHAR) AS "TABLE_CAT",
-	CAST(schema_name AS VARCHAR) AS "TABLE_SCHEM",
-	CAST(NULL        AS VARCHAR) AS "TABLE_NAME",
-	CAST(NULL        AS VARCHAR) AS "TABLE_TYPE",
-	CAST(NULL        AS VARCHAR) AS "REMARKS"
-FROM information_schema.schemata
-WHERE catalog_name NOT IN (
-	'system',
-	'temp')
-AND catalog_name NOT LIKE '__ducklake_%'
-ORDER BY "TABLE_SCHEM"
-)#";
-	} else if (table_tp == std::string(SQL_ALL_TABLE_TYPES) && catalog_n.empty() && schema_n.empty() &&
-	           table_n.empty()) {
+		return duckdb::CatalogListStmt(hstmt, duckdb::CatalogListType::SCHEMAS);
+	}
+	if (table_tp == std::string(SQL_ALL_TABLE_TYPES) && catalog_n.empty() && schema_n.empty() && table_n.empty()) {
 		// If TableType is SQL_ALL_TABLE_TYPES and CatalogName, SchemaName, and TableName are empty strings, the result
 		// set contains a list of valid table types for the data source. (All columns except the TABLE_TYPE column
 		// contain NULLs.)
-		tables_query = R"#(
-SELECT
-	CAST(NULL AS VARCHAR) AS "TABLE_CAT",
-	CAST(NULL AS VARCHAR) AS "TABLE_SCHEM",
-	CAST(NULL AS VARCHAR) AS "TABLE_NAME",
-	UNNEST([
-		CAST('TABLE' AS VARCHAR),
-		CAST('VIEW'  AS VARCHAR)
-	]) AS "TABLE_TYPE",
-	CAST(NULL AS VARCHAR) AS "REMARKS"
-)#";
-	} else {
-		// .Net ODBC driver GetSchema() call includes "SYSTEM TABLE" (doesn't exist in DuckDB),
-		// and the regex tweaks below break if "SYSTEM TABLE" is in the query, so remove it
-		table_tp = std::regex_replace(table_tp, std::regex("('SYSTEM TABLE'|SYSTEM TABLE)"), "");
-		table_tp = std::regex_replace(table_tp, std::regex(",\\s*,"), ",");
-
-		table_tp = std::regex_replace(table_tp, std::regex("('TABLE'|TABLE)"), "'BASE TABLE'");
-		table_tp = std::regex_replace(table_tp, std::regex("('VIEW'|VIEW)"), "'VIEW'");
-		table_tp = std::regex_replace(table_tp, std::regex("('%'|%)"), "'%'");
-
-		tables_query = OdbcUtils::GetQueryDuckdbTables(catalog_filter, schema_filter, table_filter, table_tp);
+		return duckdb::CatalogListStmt(hstmt, duckdb::CatalogListType::TABLE_TYPES);
 	}
 
-	return duckdb::ExecDirectStmt(hstmt, tables_query);
+	auto metadata_id = hstmt->dbc->sql_attr_metadata_id;
+	return duckdb::CatalogTablesStmt(hstmt, CatalogNameFilter::FromArgument(catalog_n, metadata_id),
+	                                 CatalogNameFilter::FromArgument(schema_n, metadata_id),
+	                                 CatalogNameFilter::FromArgument(table_n, metadata_id),
+	                                 duckdb::TableTypeFilter(table_tp));
 }
 
 /**
@@ -157,37 +102,23 @@ static SQLRETURN ColumnsInternal(SQLHSTMT statement_handle, SQLCHAR *catalog_nam
 		return ret;
 	}
 
+	auto metadata_id = hstmt->dbc->sql_attr_metadata_id;
+
+	// TABLE_CAT is always NULL, so only a catalog identifier can exclude rows
 	auto catalog_n = OdbcUtils::ConvertSQLCHARToString(catalog_name, name_length1);
-	std::string catalog_filter;
-	if (catalog_n.empty()) {
-		catalog_filter = "\"TABLE_CAT\" IS NULL";
-	} else if (hstmt->dbc->sql_attr_metadata_id == SQL_TRUE) {
-		catalog_filter = "\"TABLE_CAT\"=" + OdbcUtils::GetStringAsIdentifier(catalog_n);
-	}
+	auto catalog_filter =
+	    metadata_id == SQL_TRUE && !catalog_n.empty() ? CatalogNameFilter::Nothing() : CatalogNameFilter();
 
-	// String search pattern for schema name
+	// An empty schema name stands for the default schema
 	auto schema_n = OdbcUtils::ConvertSQLCHARToString(schema_name, name_length2);
-	std::string schema_filter = OdbcUtils::ParseStringFilter(
-	    "\"TABLE_SCHEM\"", schema_n, hstmt->dbc->sql_attr_metadata_id, std::string(DEFAULT_SCHEMA));
+	auto schema_filter = schema_n.empty() ? CatalogNameFilter::Exact(DEFAULT_SCHEMA)
+	                                      : CatalogNameFilter::FromArgument(schema_n, metadata_id);
 
-	// String search pattern for table name
 	auto table_n = OdbcUtils::ConvertSQLCHARToString(table_name, name_length3);
-	std::string table_filter =
-	    OdbcUtils::ParseStringFilter("\"TABLE_NAME\"", table_n, hstmt->dbc->sql_attr_metadata_id);
-
-	// String search pattern for column name
 	auto column_n = OdbcUtils::ConvertSQLCHARToString(column_name, name_length4);
-	std::string column_filter =
-	    OdbcUtils::ParseStringFilter("\"COLUMN_NAME\"", column_n, hstmt->dbc->sql_attr_metadata_id);
-
-	std::string sql_columns =
-	    OdbcUtils::GetQueryDuckdbColumns(catalog_filter, schema_filter, table_filter, column_filter);
-
-	ret = duckdb::ExecDirectStmt(hstmt, sql_columns);
-	if (!SQL_SUCCEEDED(ret)) {
-		return ret;
-	}
-	return SQL_SUCCESS;
+	return duckdb::CatalogColumnsStmt(hstmt, catalog_filter, schema_filter,
+	                                  CatalogNameFilter::FromArgument(table_n, metadata_id),
+	                                  CatalogNameFilter::FromArgument(column_n, metadata_id));
 }
 
 /**
@@ -220,3 +151,194 @@ SQLRETURN SQL_API SQLColumnsW(SQLHSTMT statement_handle, SQLWCHAR *catalog_name,
 	                       table_name_conv.utf8_len_smallint(), column_name_conv.utf8_str,
 	                       column_name_conv.utf8_len_smallint());
 }
+
+//===--------------------------------------------------------------------===//
+// SQLPrimaryKeys
+//===--------------------------------------------------------------------===//
+
+static SQLRETURN PrimaryKeysInternal(SQLHSTMT statement_handle, SQLCHAR *catalog_name, SQLSMALLINT name_length1,
+                                     SQLCHAR *schema_name, SQLSMALLINT name_length2, SQLCHAR *table_name,
+                                     SQLSMALLINT name_length3) {
+	duckdb::OdbcHandleStmt *hstmt = nullptr;
+	SQLRETURN ret = ConvertHSTMT(statement_handle, hstmt);
+	if (ret != SQL_SUCCESS) {
+		return ret;
+	}
+	if (!table_name) {
+		return duckdb::SetDiagnosticRecord(hstmt, SQL_ERROR, "SQLPrimaryKeys", "The table name is a null pointer",
+		                                   SQLStateType::ST_HY009, hstmt->dbc->GetDataSourceName());
+	}
+
+	auto metadata_id = hstmt->dbc->sql_attr_metadata_id;
+	auto catalog_n = OdbcUtils::ConvertSQLCHARToString(catalog_name, name_length1);
+	auto schema_n = OdbcUtils::ConvertSQLCHARToString(schema_name, name_length2);
+	auto table_n = OdbcUtils::ConvertSQLCHARToString(table_name, name_length3);
+	return duckdb::CatalogPrimaryKeysStmt(hstmt, CatalogNameFilter::FromOrdinaryArgument(catalog_n, metadata_id),
+	                                      CatalogNameFilter::FromOrdinaryArgument(schema_n, metadata_id),
+	                                      CatalogNameFilter::FromOrdinaryArgument(table_n, metadata_id));
+}
+
+/**
+ * <a
+ * href="https://learn.microsoft.com/en-us/sql/odbc/reference/syntax/sqlprimarykeys-function?view=sql-server-ver16">Docs</a>
+ */
+SQLRETURN SQL_API SQLPrimaryKeys(SQLHSTMT statement_handle, SQLCHAR *catalog_name, SQLSMALLINT name_length1,
+                                 SQLCHAR *schema_name, SQLSMALLINT name_length2, SQLCHAR *table_name,
+                                 SQLSMALLINT name_length3) {
+	return PrimaryKeysInternal(statement_handle, catalog_name, name_length1, schema_name, name_length2, table_name,
+	                           name_length3);
+}
+
+/**
+ * Wide char version.
+ * <a
+ * href="https://learn.microsoft.com/en-us/sql/odbc/reference/syntax/sqlprimarykeys-function?view=sql-server-ver16">Docs</a>
+ */
+SQLRETURN SQL_API SQLPrimaryKeysW(SQLHSTMT statement_handle, SQLWCHAR *catalog_name, SQLSMALLINT name_length1,
+                                  SQLWCHAR *schema_name, SQLSMALLINT name_length2, SQLWCHAR *table_name,
+                                  SQLSMALLINT name_length3) {
+	auto catalog_name_conv = duckdb::widechar::utf16_conv(catalog_name, name_length1);
+	auto schema_name_conv = duckdb::widechar::utf16_conv(schema_name, name_length2);
+	auto table_name_conv = duckdb::widechar::utf16_conv(table_name, name_length3);
+	return PrimaryKeysInternal(statement_handle, catalog_name_conv.utf8_str, catalog_name_conv.utf8_len_smallint(),
+	                           schema_name_conv.utf8_str, schema_name_conv.utf8_len_smallint(),
+	                           table_name_conv.utf8_str, table_name_conv.utf8_len_smallint());
+}
+
+//===--------------------------------------------------------------------===//
+// SQLForeignKeys
+//===--------------------------------------------------------------------===//
+
+static SQLRETURN ForeignKeysInternal(SQLHSTMT statement_handle, SQLCHAR *pk_catalog_name, SQLSMALLINT name_length1,
+                                     SQLCHAR *pk_schema_name, SQLSMALLINT name_length2, SQLCHAR *pk_table_name,
+                                     SQLSMALLINT name_length3, SQLCHAR *fk_catalog_name, SQLSMALLINT name_length4,
+                                     SQLCHAR *fk_schema_name, SQLSMALLINT name_length5, SQLCHAR *fk_table_name,
+                                     SQLSMALLINT name_length6) {
+	duckdb::OdbcHandleStmt *hstmt = nullptr;
+	SQLRETURN ret = ConvertHSTMT(statement_handle, hstmt);
+	if (ret != SQL_SUCCESS) {
+		return ret;
+	}
+	if (!pk_table_name && !fk_table_name) {
+		return duckdb::SetDiagnosticRecord(hstmt, SQL_ERROR, "SQLForeignKeys",
+		                                   "Both the primary key and the foreign key table names are null pointers",
+		                                   SQLStateType::ST_HY009, hstmt->dbc->GetDataSourceName());
+	}
+
+	auto metadata_id = hstmt->dbc->sql_attr_metadata_id;
+	auto pk_catalog_n = OdbcUtils::ConvertSQLCHARToString(pk_catalog_name, name_length1);
+	auto pk_schema_n = OdbcUtils::ConvertSQLCHARToString(pk_schema_name, name_length2);
+	auto pk_table_n = OdbcUtils::ConvertSQLCHARToString(pk_table_name, name_length3);
+	auto fk_catalog_n = OdbcUtils::ConvertSQLCHARToString(fk_catalog_name, name_length4);
+	auto fk_schema_n = OdbcUtils::ConvertSQLCHARToString(fk_schema_name, name_length5);
+	auto fk_table_n = OdbcUtils::ConvertSQLCHARToString(fk_table_name, name_length6);
+	// the foreign keys of a given table are found without walking the tables that could reference another one
+	bool walk_fk_tables = !fk_table_n.empty();
+	return duckdb::CatalogForeignKeysStmt(
+	    hstmt, CatalogNameFilter::FromOrdinaryArgument(pk_catalog_n, metadata_id),
+	    CatalogNameFilter::FromOrdinaryArgument(pk_schema_n, metadata_id),
+	    CatalogNameFilter::FromOrdinaryArgument(pk_table_n, metadata_id),
+	    CatalogNameFilter::FromOrdinaryArgument(fk_catalog_n, metadata_id),
+	    CatalogNameFilter::FromOrdinaryArgument(fk_schema_n, metadata_id),
+	    CatalogNameFilter::FromOrdinaryArgument(fk_table_n, metadata_id), walk_fk_tables);
+}
+
+/**
+ * <a
+ * href="https://learn.microsoft.com/en-us/sql/odbc/reference/syntax/sqlforeignkeys-function?view=sql-server-ver16">Docs</a>
+ */
+SQLRETURN SQL_API SQLForeignKeys(SQLHSTMT statement_handle, SQLCHAR *pk_catalog_name, SQLSMALLINT name_length1,
+                                 SQLCHAR *pk_schema_name, SQLSMALLINT name_length2, SQLCHAR *pk_table_name,
+                                 SQLSMALLINT name_length3, SQLCHAR *fk_catalog_name, SQLSMALLINT name_length4,
+                                 SQLCHAR *fk_schema_name, SQLSMALLINT name_length5, SQLCHAR *fk_table_name,
+                                 SQLSMALLINT name_length6) {
+	return ForeignKeysInternal(statement_handle, pk_catalog_name, name_length1, pk_schema_name, name_length2,
+	                           pk_table_name, name_length3, fk_catalog_name, name_length4, fk_schema_name, name_length5,
+	                           fk_table_name, name_length6);
+}
+
+/**
+ * Wide char version.
+ * <a
+ * href="https://learn.microsoft.com/en-us/sql/odbc/reference/syntax/sqlforeignkeys-function?view=sql-server-ver16">Docs</a>
+ */
+SQLRETURN SQL_API SQLForeignKeysW(SQLHSTMT statement_handle, SQLWCHAR *pk_catalog_name, SQLSMALLINT name_length1,
+                                  SQLWCHAR *pk_schema_name, SQLSMALLINT name_length2, SQLWCHAR *pk_table_name,
+                                  SQLSMALLINT name_length3, SQLWCHAR *fk_catalog_name, SQLSMALLINT name_length4,
+                                  SQLWCHAR *fk_schema_name, SQLSMALLINT name_length5, SQLWCHAR *fk_table_name,
+                                  SQLSMALLINT name_length6) {
+	auto pk_catalog_name_conv = duckdb::widechar::utf16_conv(pk_catalog_name, name_length1);
+	auto pk_schema_name_conv = duckdb::widechar::utf16_conv(pk_schema_name, name_length2);
+	auto pk_table_name_conv = duckdb::widechar::utf16_conv(pk_table_name, name_length3);
+	auto fk_catalog_name_conv = duckdb::widechar::utf16_conv(fk_catalog_name, name_length4);
+	auto fk_schema_name_conv = duckdb::widechar::utf16_conv(fk_schema_name, name_length5);
+	auto fk_table_name_conv = duckdb::widechar::utf16_conv(fk_table_name, name_length6);
+	return ForeignKeysInternal(
+	    statement_handle, pk_catalog_name_conv.utf8_str, pk_catalog_name_conv.utf8_len_smallint(),
+	    pk_schema_name_conv.utf8_str, pk_schema_name_conv.utf8_len_smallint(), pk_table_name_conv.utf8_str,
+	    pk_table_name_conv.utf8_len_smallint(), fk_catalog_name_conv.utf8_str, fk_catalog_name_conv.utf8_len_smallint(),
+	    fk_schema_name_conv.utf8_str, fk_schema_name_conv.utf8_len_smallint(), fk_table_name_conv.utf8_str,
+	    fk_table_name_conv.utf8_len_smallint());
+}
+
+//===--------------------------------------------------------------------===//
+// SQLStatistics
+//===--------------------------------------------------------------------===//
+
+static SQLRETURN StatisticsInternal(SQLHSTMT statement_handle, SQLCHAR *catalog_name, SQLSMALLINT name_length1,
+                                    SQLCHAR *schema_name, SQLSMALLINT name_length2, SQLCHAR *table_name,
+                                    SQLSMALLINT name_length3, SQLUSMALLINT unique, SQLUSMALLINT reserved) {
+	duckdb::OdbcHandleStmt *hstmt = nullptr;
+	SQLRETURN ret = ConvertHSTMT(statement_handle, hstmt);
+	if (ret != SQL_SUCCESS) {
+		return ret;
+	}
+	if (!table_name) {
+		return duckdb::SetDiagnosticRecord(hstmt, SQL_ERROR, "SQLStatistics", "The table name is a null pointer",
+		                                   SQLStateType::ST_HY009, hstmt->dbc->GetDataSourceName());
+	}
+	if (unique != SQL_INDEX_UNIQUE && unique != SQL_INDEX_ALL) {
+		return duckdb::SetDiagnosticRecord(hstmt, SQL_ERROR, "SQLStatistics", "Invalid Unique argument",
+		                                   SQLStateType::ST_HY100, hstmt->dbc->GetDataSourceName());
+	}
+	if (reserved != SQL_QUICK && reserved != SQL_ENSURE) {
+		return duckdb::SetDiagnosticRecord(hstmt, SQL_ERROR, "SQLStatistics", "Invalid Reserved argument",
+		                                   SQLStateType::ST_HY101, hstmt->dbc->GetDataSourceName());
+	}
+
+	auto metadata_id = hstmt->dbc->sql_attr_metadata_id;
+	auto catalog_n = OdbcUtils::ConvertSQLCHARToString(catalog_name, name_length1);
+	auto schema_n = OdbcUtils::ConvertSQLCHARToString(schema_name, name_length2);
+	auto table_n = OdbcUtils::ConvertSQLCHARToString(table_name, name_length3);
+	return duckdb::CatalogStatisticsStmt(hstmt, CatalogNameFilter::FromOrdinaryArgument(catalog_n, metadata_id),
+	                                     CatalogNameFilter::FromOrdinaryArgument(schema_n, metadata_id),
+	                                     CatalogNameFilter::FromOrdinaryArgument(table_n, metadata_id), unique,
+	                                     reserved);
+}
+
+/**
+ * <a
+ * href="https://learn.microsoft.com/en-us/sql/odbc/reference/syntax/sqlstatistics-function?view=sql-server-ver16">Docs</a>
+ */
+SQLRETURN SQL_API SQLStatistics(SQLHSTMT statement_handle, SQLCHAR *catalog_name, SQLSMALLINT name_length1,
+                                SQLCHAR *schema_name, SQLSMALLINT name_length2, SQLCHAR *table_name,
+                                SQLSMALLINT name_length3, SQLUSMALLINT unique, SQLUSMALLINT reserved) {
+	return StatisticsInternal(statement_handle, catalog_name, name_length1, schema_name, name_length2, table_name,
+	                          name_length3, unique, reserved);
+}
+
+/**
+ * Wide char version.
+ * <a
+ * href="https://learn.microsoft.com/en-us/sql/odbc/reference/syntax/sqlstatistics-function?view=sql-server-ver16">Docs</a>
+ */
+SQLRETURN SQL_API SQLStatisticsW(SQLHSTMT statement_handle, SQLWCHAR *catalog_name, SQLSMALLINT name_length1,
+                                 SQLWCHAR *schema_name, SQLSMALLINT name_length2, SQLWCHAR *table_name,
+                                 SQLSMALLINT name_length3, SQLUSMALLINT unique, SQLUSMALLINT reserved) {
+	auto catalog_name_conv = duckdb::widechar::utf16_conv(catalog_name, name_length1);
+	auto schema_name_conv = duckdb::widechar::utf16_conv(schema_name, name_length2);
+	auto table_name_conv = duckdb::widechar::utf16_conv(table_name, name_length3);
+	return StatisticsInternal(statement_handle, catalog_name_conv.utf8_str, catalog_name_conv.utf8_len_smallint(),
+	                          schema_name_conv.utf8_str, schema_name_conv.utf8_len_smallint(), table_name_conv.utf8_str,
+	                          table_name_conv.utf8_len_smallint(), unique, reserved);
+}
@@ -3,6 +3,8 @@
 #include "handle_functions.hpp"
 #include "odbc_fetch.hpp"
 #include "parameter_descriptor.hpp"
+#include "query_watchdog.hpp"
+#include "statement_cancel.hpp"
 #include "duckdb/main/prepared_statement_data.hpp"
 
 //===--------------------------------------------------------------------===//
@@ -22,7 +24,13 @@ static SQLRETURN ExecuteBeforeFetch(SQLHSTMT statement_handle) {
 	}
 	// check if it's needed to execute the stmt before fetch
 	if (hstmt->param_desc->HasParamSetToProcess()) {
-		auto rc = duckdb::SingleExecuteStmt(hstmt);
+		ret = hstmt->dbc->SpillStreamingResults(hstmt, hstmt);
+		if (ret != SQL_SUCCESS) {
+			return ret;
+		}
+		duckdb::StatementCancelScope cancel_scope(*hstmt);
+		duckdb::QueryTimeoutGuard timeout(*hstmt);
+		auto rc = cancel_scope.Finish(timeout.Finish(*hstmt, duckdb::SingleExecuteStmt(hstmt)));
 		if (rc == SQL_SUCCESS || rc == SQL_STILL_EXECUTING) {
 			return SQL_SUCCESS;
 		}
@@ -4,10 +4,9 @@
 #include "odbc_utils.hpp"
 #include "statement_functions.hpp"
 #include "handle_functions.hpp"
+#include "insert_batch.hpp"
 #include "widechar.hpp"
 
-#include <regex>
-
 using duckdb::LogicalTypeId;
 using duckdb::OdbcUtils;
 using duckdb::SQLStateType;
@@ -23,11 +22,27 @@ static SQLRETURN PrepareInternal(SQLHSTMT statement_handle, SQLCHAR *statement_t
 		return ret;
 	}
 
+	ret = CheckNoAsyncExecution(hstmt, "SQLPrepare");
+	if (ret != SQL_SUCCESS) {
+		return ret;
+	}
+	ret = hstmt->dbc->SpillStreamingResults(hstmt, hstmt);
+	if (ret != SQL_SUCCESS) {
+		return ret;
+	}
 	const auto query = OdbcUtils::ConvertSQLCHARToString(statement_text, text_length);
+	ret = hstmt->dbc->FlushInsertBatch(hstmt);
+	if (ret != SQL_SUCCESS) {
+		return ret;
+	}
 	PrepareQuery(hstmt);
 	hstmt->stmt = hstmt->dbc->conn->Prepare(query);
 
-	return FinalizeStmt(hstmt);
+	ret = FinalizeStmt(hstmt);
+	if (SQL_SUCCEEDED(ret)) {
+		hstmt->insert_batch = duckdb::InsertBatch::TryCreate(*hstmt, hstmt->dbc->insert_batch_size);
+	}
+	return ret;
 }
 
 /**
@@ -108,12 +123,16 @@ SQLRETURN SQL_API SQLExecDirectW(SQLHSTMT statement_handle, SQLWCHAR *statement_
  * href="https://learn.microsoft.com/en-us/sql/odbc/reference/syntax/sqlcancel-function?view=sql-server-ver16">Docs</a>
  */
 SQLRETURN SQL_API SQLCancel(SQLHSTMT statement_handle) {
-	duckdb::OdbcHandleStmt *hstmt = nullptr;
-	SQLRETURN ret = ConvertHSTMT(statement_handle, hstmt);
-	if (ret != SQL_SUCCESS) {
-		return ret;
+	// called from another thread while the statement runs, so its diagnostics are not cleaned like in ConvertHSTMT
+	auto hstmt = static_cast<duckdb::OdbcHandleStmt *>(statement_handle);
+	if (!hstmt || hstmt->type != duckdb::OdbcHandleType::STMT) {
+		return SQL_INVALID_HANDLE;
+	}
+	if (!hstmt->dbc || !hstmt->dbc->conn) {
+		return duckdb::SetDiagnosticRecord(hstmt, SQL_ERROR, "dbc", "No database connection found",
+		                                   SQLStateType::ST_08003, "");
 	}
 
-	hstmt->dbc->conn->Interrupt();
+	hstmt->Cancel();
 	return SQL_SUCCESS;
 }
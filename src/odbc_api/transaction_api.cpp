@@ -26,12 +26,23 @@ SQLRETURN SQL_API SQLEndTran(SQLSMALLINT handle_type, SQLHANDLE handle, SQLSMALL
 		return ret;
 	}
 
+	// ending the transaction would invalidate the pending execution
+	if (dbc->async_stmt) {
+		return duckdb::SetDiagnosticRecord(dbc, SQL_ERROR, "SQLEndTran",
+		                                   "An asynchronous execution is in progress on the connection",
+		                                   SQLStateType::ST_HY010, dbc->GetDataSourceName());
+	}
+
 	switch (completion_type) {
 	case SQL_COMMIT:
-		// it needs to materialize the result set because ODBC can still fetch after a commit
-		if (dbc->MaterializeResult() != SQL_SUCCESS) {
-			// for some reason we couldn't materialize the result set
-			return SQL_ERROR; // TODO add a proper error message
+		ret = dbc->FlushInsertBatch(dbc);
+		if (ret != SQL_SUCCESS) {
+			return ret;
+		}
+		// the open result sets are spilled because ODBC can still fetch after a commit
+		ret = dbc->SpillStreamingResults(dbc);
+		if (ret != SQL_SUCCESS) {
+			return ret;
 		}
 		if (dbc->conn->IsAutoCommit()) {
 			return SQL_SUCCESS;
@@ -39,6 +50,15 @@ SQLRETURN SQL_API SQLEndTran(SQLSMALLINT handle_type, SQLHANDLE handle, SQLSMALL
 		dbc->conn->Commit();
 		return SQL_SUCCESS;
 	case SQL_ROLLBACK:
+		if (dbc->conn->IsAutoCommit()) {
+			// the buffered executions were reported as inserted, there is no transaction to roll them back
+			ret = dbc->FlushInsertBatch(dbc);
+			if (ret != SQL_SUCCESS) {
+				return ret;
+			}
+		} else {
+			dbc->ClearInsertBatch();
+		}
 		try {
 			dbc->conn->Rollback();
 			return SQL_SUCCESS;
@@ -2,6 +2,7 @@
 #include "api_info.hpp"
 #include "statement_functions.hpp"
 #include "handle_functions.hpp"
+#include "duckdb/common/string_util.hpp"
 #include "duckdb/common/vector.hpp"
 
 using duckdb::ApiInfo;
@@ -103,34 +104,59 @@ void ApiInfo::FindDataType(SQLSMALLINT data_type, vector<OdbcTypeInfo> &vec_type
 	}
 }
 
-void ApiInfo::WriteInfoTypesToQueryString(const vector<OdbcTypeInfo> &vec_types, string &query) {
-	for (duckdb::idx_t i = 0; i < vec_types.size(); i++) {
-		auto info_type = vec_types[i];
-		query += "(";
-		query += "CAST(" + string(info_type.type_name) + " AS VARCHAR),";
-		query += "CAST(" + std::to_string(info_type.data_type) + " AS SMALLINT),";
-		query += "CAST(" + std::to_string(info_type.column_size) + " AS INTEGER),";
-		query += "CAST(" + string(info_type.literal_prefix) + " AS VARCHAR),";
-		query += "CAST(" + string(info_type.literal_suffix) + " AS VARCHAR),";
-		query += "CAST(" + string(info_type.create_params) + " AS VARCHAR),";
-		query += "CAST(" + std::to_string(info_type.nullable) + " AS SMALLINT),";
-		query += "CAST(" + std::to_string(info_type.case_sensitive) + " AS SMALLINT),";
-		query += "CAST(" + std::to_string(info_type.searchable) + " AS SMALLINT),";
-		query += "CAST(" + std::to_string(info_type.unsigned_attribute) + " AS SMALLINT),";
-		query += "CAST(" + std::to_string(info_type.fixed_prec_scale) + " AS SMALLINT),";
-		query += "CAST(" + std::to_string(info_type.auto_unique_value) + " AS SMALLINT),";
-		query += "CAST(" + string(info_type.local_type_name) + " AS VARCHAR),";
-		query += "CAST(" + std::to_string(info_type.minimum_scale) + " AS SMALLINT),";
-		query += "CAST(" + std::to_string(info_type.maximum_scale) + " AS SMALLINT),";
-		query += "CAST(" + std::to_string(info_type.sql_data_type) + " AS SMALLINT),";
-		query += "CAST(" + std::to_string(info_type.sql_datetime_sub) + " AS SMALLINT),";
-		query += "CAST(" + std::to_string(info_type.num_prec_radix) + " AS integer),";
-		query += "CAST(" + std::to_string(info_type.interval_precision) + " AS SMALLINT)";
-		query += ")";
+const OdbcTypeInfo *ApiInfo::FindFirstDataType(SQLSMALLINT data_type) {
+	for (auto &type_info : ODBC_SUPPORTED_SQL_TYPES) {
+		if (type_info.data_type == data_type) {
+			return &type_info;
+		}
+	}
+	return nullptr;
+}
 
-		if (vec_types.size() > 1 && (i + 1) < vec_types.size()) {
-			query += ",";
+//! Value of a string field of OdbcTypeInfo, the field holds a SQL string literal or NULL
+static duckdb::Value LiteralToValue(const char *literal) {
+	std::string str(literal);
+	if (str == "NULL") {
+		return duckdb::Value(duckdb::LogicalType::VARCHAR);
+	}
+	// the quotes inside the literal are doubled
+	return duckdb::Value(duckdb::StringUtil::Replace(str.substr(1, str.size() - 2), "''", "'"));
+}
+
+void ApiInfo::WriteInfoTypesToCollection(const vector<OdbcTypeInfo> &vec_types,
+                                         duckdb::ColumnDataCollection &collection) {
+	duckdb::DataChunk chunk;
+	chunk.Initialize(duckdb::Allocator::DefaultAllocator(), collection.Types());
+	for (auto &info_type : vec_types) {
+		if (chunk.size() == STANDARD_VECTOR_SIZE) {
+			collection.Append(chunk);
+			chunk.Reset();
 		}
+		auto row = chunk.size();
+		chunk.SetCardinality(row + 1);
+		idx_t col = 0;
+		chunk.SetValue(col++, row, LiteralToValue(info_type.type_name));
+		chunk.SetValue(col++, row, duckdb::Value::SMALLINT(info_type.data_type));
+		chunk.SetValue(col++, row, duckdb::Value::INTEGER(info_type.column_size));
+		chunk.SetValue(col++, row, LiteralToValue(info_type.literal_prefix));
+		chunk.SetValue(col++, row, LiteralToValue(info_type.literal_suffix));
+		chunk.SetValue(col++, row, LiteralToValue(info_type.create_params));
+		chunk.SetValue(col++, row, duckdb::Value::SMALLINT(info_type.nullable));
+		chunk.SetValue(col++, row, duckdb::Value::SMALLINT(info_type.case_sensitive));
+		chunk.SetValue(col++, row, duckdb::Value::SMALLINT(info_type.searchable));
+		chunk.SetValue(col++, row, duckdb::Value::SMALLINT(info_type.unsigned_attribute));
+		chunk.SetValue(col++, row, duckdb::Value::SMALLINT(info_type.fixed_prec_scale));
+		chunk.SetValue(col++, row, duckdb::Value::SMALLINT(info_type.auto_unique_value));
+		chunk.SetValue(col++, row, LiteralToValue(info_type.local_type_name));
+		chunk.SetValue(col++, row, duckdb::Value::SMALLINT(info_type.minimum_scale));
+		chunk.SetValue(col++, row, duckdb::Value::SMALLINT(info_type.maximum_scale));
+		chunk.SetValue(col++, row, duckdb::Value::SMALLINT(info_type.sql_data_type));
+		chunk.SetValue(col++, row, duckdb::Value::SMALLINT(info_type.sql_datetime_sub));
+		chunk.SetValue(col++, row, duckdb::Value::INTEGER(info_type.num_prec_radix));
+		chunk.SetValue(col++, row, duckdb::Value::SMALLINT(info_type.interval_precision));
+	}
+	if (chunk.size() > 0) {
+		collection.Append(chunk);
 	}
 }
 
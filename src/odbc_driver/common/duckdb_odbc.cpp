@@ -1,12 +1,16 @@
 #include "duckdb_odbc.hpp"
 #include "api_info.hpp"
 #include "descriptor.hpp"
+#include "handle_functions.hpp"
+#include "insert_batch.hpp"
 #include "odbc_fetch.hpp"
 #include "odbc_interval.hpp"
 #include "parameter_descriptor.hpp"
 #include "row_descriptor.hpp"
 #include "duckdb/main/database_manager.hpp"
 #include "duckdb/main/attached_database.hpp"
+#include "duckdb/main/materialized_query_result.hpp"
+#include "duckdb/main/stream_query_result.hpp"
 
 using duckdb::OdbcDiagnostic;
 using duckdb::OdbcHandle;
@@ -53,6 +57,12 @@ OdbcHandleDbc::~OdbcHandleDbc() {
 }
 
 void OdbcHandleDbc::EraseStmtRef(OdbcHandleStmt *stmt) {
+	if (insert_batch_stmt == stmt) {
+		insert_batch_stmt = nullptr;
+	}
+	if (async_stmt == stmt) {
+		async_stmt = nullptr;
+	}
 	// erase the reference from vec_stmt_ref
 	for (duckdb::idx_t v_idx = 0; v_idx < vec_stmt_ref.size(); ++v_idx) {
 		if (vec_stmt_ref[v_idx] == stmt) {
@@ -62,12 +72,21 @@ void OdbcHandleDbc::EraseStmtRef(OdbcHandleStmt *stmt) {
 	}
 }
 
-SQLRETURN OdbcHandleDbc::MaterializeResult() {
-	if (vec_stmt_ref.empty()) {
-		return SQL_SUCCESS;
+SQLRETURN OdbcHandleDbc::SpillStreamingResults(OdbcHandle *handle, OdbcHandleStmt *except) {
+	for (auto stmt : vec_stmt_ref) {
+		if (stmt == except) {
+			continue;
+		}
+		SQLRETURN ret = stmt->SpillResult();
+		if (ret != SQL_SUCCESS) {
+			// the spilled statement keeps its own record, the application is waiting for the call on 'handle'
+			return duckdb::SetDiagnosticRecord(handle, SQL_ERROR, "SpillStreamingResults",
+			                                   "Failed to materialize the result of another statement: " +
+			                                       stmt->res->GetError(),
+			                                   SQLStateType::ST_HY000, GetDataSourceName());
+		}
 	}
-	// only materializing the result set from the last statement
-	return vec_stmt_ref.back()->MaterializeResult();
+	return SQL_SUCCESS;
 }
 
 void OdbcHandleDbc::ResetStmtDescriptors(OdbcHandleDesc *old_desc) {
@@ -95,9 +114,45 @@ std::string OdbcHandleDbc::GetDataSourceName() {
 	return dsn;
 }
 
+const std::string &OdbcHandleDbc::GetSystemCatalogName() {
+	auto &db = DatabaseInstance::GetDatabase(*conn->context);
+	// a pooled connection can be handed a connection to another database
+	if (system_catalog_db != &db) {
+		system_catalog_name = db.GetDatabaseManager().GetSystemCatalog().GetAttached().GetName();
+		system_catalog_db = &db;
+	}
+	return system_catalog_name;
+}
+
+SQLRETURN OdbcHandleDbc::FlushInsertBatch(OdbcHandle *handle) {
+	if (!insert_batch_stmt) {
+		return SQL_SUCCESS;
+	}
+	auto stmt = insert_batch_stmt;
+	insert_batch_stmt = nullptr;
+	D_ASSERT(stmt->insert_batch);
+	try {
+		stmt->insert_batch->Flush();
+	} catch (std::exception &ex) {
+		duckdb::ErrorData parsed_error(ex);
+		return duckdb::SetDiagnosticRecord(handle, SQL_ERROR, "FlushInsertBatch",
+		                                   "Failed to insert batched rows: " + parsed_error.RawMessage(),
+		                                   SQLStateType::ST_HY000, GetDataSourceName());
+	}
+	return SQL_SUCCESS;
+}
+
+void OdbcHandleDbc::ClearInsertBatch() {
+	if (!insert_batch_stmt) {
+		return;
+	}
+	insert_batch_stmt->insert_batch->Clear();
+	insert_batch_stmt = nullptr;
+}
+
 //! OdbcHandleStmt functions **************************************************
 OdbcHandleStmt::OdbcHandleStmt(OdbcHandleDbc *dbc_p)
-    : OdbcHandle(OdbcHandleType::STMT), dbc(dbc_p), rows_fetched_ptr(nullptr) {
+    : OdbcHandle(OdbcHandleType::STMT), dbc(dbc_p), rows_fetched_ptr(nullptr), async_enable(dbc_p->async_enable) {
 	D_ASSERT(dbc_p);
 	D_ASSERT(dbc_p->conn);
 
@@ -113,6 +168,7 @@ OdbcHandleStmt::~OdbcHandleStmt() {
 }
 
 void OdbcHandleStmt::Close() {
+	CancelPending();
 	open = false;
 	res.reset();
 	odbc_fetcher->ClearChunks();
@@ -121,14 +177,70 @@ void OdbcHandleStmt::Close() {
 	// stmt->stmt.reset(); // the statment can be reuse in prepared statement
 }
 
-SQLRETURN OdbcHandleStmt::MaterializeResult() {
-	if (!stmt || stmt->HasError()) {
+void OdbcHandleStmt::CancelPending() {
+	if (!pending) {
+		return;
+	}
+	// stops the tasks that the background threads still run for the query
+	if (dbc->conn) {
+		dbc->conn->context->Interrupt();
+	}
+	SwapPending();
+	if (dbc->async_stmt == this) {
+		dbc->async_stmt = nullptr;
+	}
+}
+
+duckdb::unique_ptr<duckdb::PendingQueryResult>
+OdbcHandleStmt::SwapPending(duckdb::unique_ptr<PendingQueryResult> new_pending) {
+	lock_guard<mutex> guard(dbc->running_lock);
+	std::swap(pending, new_pending);
+	return new_pending;
+}
+
+void OdbcHandleStmt::Cancel() {
+	lock_guard<mutex> guard(dbc->running_lock);
+	if (!pending && dbc->running_stmt != this) {
+		return;
+	}
+	canceled = true;
+	// the connection runs one query at a time, so the interrupt only reaches the query of this statement
+	if (dbc->conn) {
+		dbc->conn->context->Interrupt();
+	}
+}
+
+SQLRETURN OdbcHandleStmt::SpillResult() {
+	if (!res || res->HasError() || res->type != QueryResultType::STREAM_RESULT) {
 		return SQL_SUCCESS;
 	}
-	if (!res || res->HasError()) {
+	auto &stream = res->Cast<StreamQueryResult>();
+	if (!stream.IsOpen()) {
 		return SQL_SUCCESS;
 	}
-	return odbc_fetcher->Materialize(this);
+	try {
+		// the rows not fetched yet are kept by the buffer manager, which can offload them to the temp directory
+		auto collection = make_uniq<ColumnDataCollection>(*dbc->conn->context, stream.types);
+		ColumnDataAppendState append_state;
+		collection->InitializeAppend(append_state);
+		while (true) {
+			auto chunk = stream.Fetch();
+			if (!chunk || chunk->size() == 0) {
+				break;
+			}
+			collection->Append(append_state, *chunk);
+		}
+		if (!stream.HasError()) {
+			res = make_uniq<MaterializedQueryResult>(stream.statement_type, stream.properties, stream.names,
+			                                         std::move(collection), stream.client_properties);
+			return SQL_SUCCESS;
+		}
+	} catch (std::exception &ex) {
+		stream.SetError(ErrorData(ex));
+	}
+	open = false;
+	return SetDiagnosticRecord(this, SQL_ERROR, "SpillResult", stream.GetError(), SQLStateType::ST_HY000,
+	                           dbc->GetDataSourceName());
 }
 
 void OdbcHandleStmt::SetARD(OdbcHandleDesc *new_ard) {
@@ -145,16 +257,20 @@ void OdbcHandleStmt::FillIRD() {
 	ird->Reset();
 	ird->header.sql_desc_count = 0;
 	auto num_cols = stmt->ColumnCount();
+	auto &types = stmt->GetTypes();
+	auto &names = stmt->GetNames();
+	auto &catalog_name = dbc->GetSystemCatalogName();
+	// the records are built in place, a wide result must not copy them while growing
+	ird->records.reserve(num_cols);
 	for (duckdb::idx_t col_idx = 0; col_idx < num_cols; ++col_idx) {
-		duckdb::DescRecord new_record;
-		auto col_type = stmt->GetTypes()[col_idx];
+		ird->records.emplace_back();
+		auto &new_record = ird->records.back();
+		auto &col_type = types[col_idx];
 
 		// TODO: Make more specific?
-		auto name = stmt->GetNames()[col_idx];
-		new_record.sql_desc_base_column_name = name;
-		new_record.sql_desc_name = name;
-		new_record.sql_desc_label = name;
-		new_record.sql_desc_length = new_record.sql_desc_label.size();
+		// the label and the base column name are left empty, they are the name of the column
+		new_record.sql_desc_name = names[col_idx];
+		new_record.sql_desc_length = new_record.sql_desc_name.size();
 
 		new_record.sql_desc_unnamed = new_record.sql_desc_name.empty() ? SQL_UNNAMED : SQL_NAMED;
 
@@ -189,15 +305,10 @@ void OdbcHandleStmt::FillIRD() {
 		new_record.sql_desc_display_size = duckdb::ApiInfo::GetDisplaySize(col_type);
 		new_record.SetDescUnsignedField(col_type);
 
-		auto &db_manager = dbc->env->db->instance->GetDatabaseManager();
-		auto &catalog_name = db_manager.GetSystemCatalog().GetAttached().GetName();
-
 		new_record.sql_desc_catalog_name = catalog_name;
 
 		// TODO: this is not correct, we need to get the schema name from the table, but the docs say that if it cannot
 		// be determined, to return an empty string
 		new_record.sql_desc_schema_name = "";
-
-		ird->records.emplace_back(new_record);
 	}
 }
@@ -34,9 +34,6 @@ SQLRETURN duckdb::ConvertEnvironment(SQLHANDLE &environment_handle, OdbcHandleEn
 	if (env->type != OdbcHandleType::ENV) {
 		return SQL_INVALID_HANDLE;
 	}
-	if (!env->db) {
-		return SetDiagnosticRecord(env, SQL_ERROR, "env", "No database connection found", SQLStateType::ST_HY000, "");
-	}
 
 	return SQL_SUCCESS;
 }
@@ -24,41 +24,6 @@ void OdbcFetch::IncreaseRowCount() {
 	}
 }
 
-SQLRETURN OdbcFetch::Materialize(OdbcHandleStmt *hstmt) {
-	// preserve states before materialization
-	auto before_cur_chunk = current_chunk;
-	auto before_cur_chunk_idx = current_chunk_idx;
-	auto before_chunk_row = chunk_row;
-	auto before_prior_chunk_row = prior_chunk_row;
-
-	SQLRETURN ret;
-	do {
-		ret = FetchNext(hstmt);
-	} while (SQL_SUCCEEDED(ret));
-
-	D_ASSERT(resultset_end);
-
-	// restore states
-	if (before_cur_chunk) {
-		current_chunk = before_cur_chunk;
-		current_chunk_idx = before_cur_chunk_idx;
-		chunk_row = before_chunk_row;
-		prior_chunk_row = before_prior_chunk_row;
-	} else {
-		if (!chunks.empty()) {
-			current_chunk = chunks.front().get();
-		}
-		current_chunk_idx = 0;
-		chunk_row = prior_chunk_row = -1;
-	}
-
-	if (ret == SQL_NO_DATA || ret == SQL_SUCCESS) {
-		return SQL_SUCCESS;
-	}
-
-	return ret;
-}
-
 SQLRETURN OdbcFetch::FetchNext(OdbcHandleStmt *hstmt) {
 	// case hasn't reached the end of query result, then try to fetch
 	if (!resultset_end) {
@@ -6,7 +6,6 @@
 
 #include <algorithm>
 #include <mutex>
-#include <regex>
 
 #ifndef _WIN32
 #include <time.h>
@@ -45,212 +44,6 @@ bool OdbcUtils::IsCharType(SQLSMALLINT type) {
 	}
 }
 
-std::string OdbcUtils::GetStringAsIdentifier(const string &str) {
-	string str_ret;
-
-	std::regex regex_str_quoted("^(\".*\"|\'.*\')$");
-
-	if (std::regex_match(str, regex_str_quoted)) {
-		// removing quotes
-		str_ret = str_ret.substr(1, str_ret.size() - 2);
-		// removing leading and trailing blanks
-		str_ret = std::regex_replace(str, std::regex("^ +| +$|( ) +"), "$1");
-	} else {
-		// removing trailing blanks
-		str_ret = std::regex_replace(str, std::regex(" +$|( ) +"), "$1");
-		str_ret = duckdb::StringUtil::Upper(str_ret);
-	}
-
-	return str_ret;
-}
-
-std::string OdbcUtils::ParseStringFilter(const string &filter_name, const string &filter_value,
-                                         SQLUINTEGER sql_attr_metadata_id, const string &coalesce_str) {
-	string filter;
-	if (filter_value.empty()) {
-		if (coalesce_str.empty()) {
-			filter = "COALESCE(" + filter_name + ",'') LIKE  '%'";
-		} else {
-			filter = "COALESCE(" + filter_name + ",'" + coalesce_str + "') LIKE '" + coalesce_str + "'";
-		}
-	} else if (sql_attr_metadata_id == SQL_TRUE) {
-		filter = filter_name + "=" + OdbcUtils::GetStringAsIdentifier(filter_value);
-	} else {
-		filter = filter_name + " LIKE '" + filter_value + "'";
-	}
-	// Handle escape character passed by Power Query SDK
-	filter += " ESCAPE '\\'";
-	return filter;
-}
-
-std::string OdbcUtils::GetQueryDuckdbColumns(const string &catalog_filter, const string &schema_filter,
-                                             const string &table_filter, const string &column_filter) {
-	string sql_duckdb_columns = R"(
-        SELECT * EXCLUDE (mapping, data_type_no_typmod)
-        FROM (
-            SELECT NULL::VARCHAR AS "TABLE_CAT",
-            SCHEMA_NAME AS "TABLE_SCHEM",
-            TABLE_NAME AS "TABLE_NAME",
-            COLUMN_NAME AS "COLUMN_NAME",
-            MAP {
-                'BOOLEAN': 1, -- SQL_CHAR
-                'TINYINT': -6, -- SQL_TINYINT
-                'UTINYINT': -6, -- SQL_TINYINT
-                'SMALLINT': 5, -- SQL_SMALLINT
-                'USMALLINT': 5, -- SQL_SMALLINT
-                'INTEGER': 4, -- SQL_INTEGER
-                'UINTEGER': 4, -- SQL_INTEGER
-                'BIGINT': -5, -- SQL_BIGINT
-                'UBIGINT': -5, -- SQL_BIGINT
-                'HUGEINT': 2, -- SQL_NUMERIC
-                'UHUGEINT': 2, -- SQL_NUMERIC
-                'FLOAT': 6, -- SQL_FLOAT
-                'DOUBLE': 8, -- SQL_DOUBLE
-                'DATE': 91, -- SQL_TYPE_DATE
-                'TIME': 92, -- SQL_TYPE_TIME
-                'VARCHAR': 12, -- SQL_VARCHAR
-                'BLOB': -3, -- SQL_VARBINARY
-                'INTERVAL': 10, -- SQL_INTERVAL
-                'DECIMAL': 2, -- SQL_NUMERIC
-                'BIT': -7, -- SQL_BIT
-                'LIST': 12 -- SQL_VARCHAR
-            } AS mapping,
-            STRING_SPLIT(data_type, '(')[1] AS data_type_no_typmod,
-            CASE
-                -- value 93 is SQL_TIMESTAMP
-                -- TODO: investigate why map key with spaces and regexes don't work
-                WHEN data_type LIKE 'TIMESTAMP%' THEN 93::SMALLINT
-                WHEN mapping[data_type_no_typmod] IS NOT NULL THEN mapping[data_type_no_typmod]::SMALLINT
-                ELSE data_type_id::SMALLINT
-            END AS "DATA_TYPE",
-            CASE
-                WHEN data_type_no_typmod = 'DECIMAL' THEN 'NUMERIC'
-                WHEN data_type LIKE 'TIMESTAMP%' THEN 'TIMESTAMP'
-                ELSE data_type_no_typmod
-            END AS "TYPE_NAME",
-            CASE
-                WHEN data_type='DATE' THEN 12
-                WHEN data_type='TIME' THEN 15
-                WHEN data_type LIKE 'TIMESTAMP%' THEN 26
-                WHEN data_type='CHAR'
-                    OR data_type='BOOLEAN' THEN 1
-                WHEN data_type='VARCHAR'
-                    OR data_type='BLOB' THEN character_maximum_length
-                WHEN data_type LIKE '%INT%' THEN numeric_precision
-                WHEN data_type like 'DECIMAL%' THEN numeric_precision
-                WHEN data_type='FLOAT'
-                    OR data_type='DOUBLE' THEN numeric_precision
-                ELSE NULL
-            END AS "COLUMN_SIZE",
-            CASE
-                WHEN data_type='DATE' THEN 4
-                WHEN data_type LIKE 'TIMESTAMP%' THEN 8
-                WHEN data_type LIKE 'TIME%' THEN 8 
-                WHEN data_type='CHAR'
-                    OR data_type='BOOLEAN' THEN 1
-                WHEN data_type='VARCHAR'
-                    OR data_type='BLOB' THEN 16
-                WHEN data_type LIKE '%TINYINT' THEN 1
-                WHEN data_type LIKE '%SMALLINT' THEN 2
-                WHEN data_type LIKE '%INTEGER' THEN 4
-                WHEN data_type LIKE '%BIGINT' THEN 8
-                WHEN data_type='HUGEINT' THEN 16
-                WHEN data_type like 'DECIMAL%' THEN 16
-                WHEN data_type='FLOAT' THEN 4
-                WHEN data_type='DOUBLE' THEN 8
-                ELSE NULL
-            END AS "BUFFER_LENGTH",
-            numeric_scale::SMALLINT AS "DECIMAL_DIGITS",
-            numeric_precision_radix::SMALLINT "NUM_PREC_RADIX",
-            CASE is_nullable
-                WHEN FALSE THEN 0::SMALLINT
-                WHEN TRUE THEN 1::SMALLINT
-                ELSE 2::SMALLINT
-            END AS "NULLABLE",
-            '' AS "REMARKS",
-            column_default AS "COLUMN_DEF",
-            CASE
-                WHEN data_type LIKE 'TIMESTAMP%' THEN 93::SMALLINT
-                WHEN mapping[data_type_no_typmod] IS NOT NULL THEN mapping[data_type_no_typmod]::SMALLINT
-                ELSE data_type_id::SMALLINT
-            END AS "SQL_DATA_TYPE",
-            CASE
-                WHEN data_type='DATE' then 1::SMALLINT
-                WHEN data_type LIKE 'TIMESTAMP%' THEN 3::SMALLINT
-                WHEN data_type LIKE 'TIME%' THEN 2::SMALLINT
-                ELSE NULL::SMALLINT
-            END AS "SQL_DATETIME_SUB",
-            CASE
-                WHEN data_type='%CHAR'
-                     OR data_type='BLOB' THEN character_maximum_length
-                ELSE NULL
-            END AS "CHAR_OCTET_LENGTH",
-            column_index AS "ORDINAL_POSITION",
-            CASE is_nullable
-                WHEN FALSE THEN 'NO'
-                WHEN TRUE THEN 'YES'
-                ELSE ''
-            END AS "IS_NULLABLE"
-            FROM duckdb_columns
-        )
-	)";
-
-	sql_duckdb_columns += " WHERE ";
-	if (!catalog_filter.empty()) {
-		sql_duckdb_columns += catalog_filter + " AND ";
-	}
-	if (!schema_filter.empty()) {
-		sql_duckdb_columns += schema_filter + " AND ";
-	}
-	if (!table_filter.empty()) {
-		sql_duckdb_columns += table_filter + " AND ";
-	}
-	sql_duckdb_columns += column_filter;
-
-	// clang-format off
-	sql_duckdb_columns += R"(
-		ORDER BY
-			"TABLE_CAT",
-			"TABLE_SCHEM",
-			"TABLE_NAME",
-			"ORDINAL_POSITION"
-	)";
-	// clang-format on
-
-	return sql_duckdb_columns;
-}
-
-std::string OdbcUtils::GetQueryDuckdbTables(const string &catalog_filter, const string &schema_filter,
-                                            const string &table_filter, const string &table_type_filter) {
-	string sql_duckdb_tables = R"(
-		SELECT
-			table_catalog::VARCHAR "TABLE_CAT",
-			table_schema::VARCHAR "TABLE_SCHEM",
-			table_name::VARCHAR "TABLE_NAME",
-			CASE
-				WHEN table_type='BASE TABLE'
-				THEN 'TABLE'::VARCHAR
-				ELSE table_type::VARCHAR
-			END "TABLE_TYPE",
-			''::VARCHAR "REMARKS"
-			FROM information_schema.tables
-	)";
-
-	sql_duckdb_tables += " WHERE " + catalog_filter + "\n AND " + schema_filter + "\n AND " + table_filter;
-
-	if (!table_type_filter.empty()) {
-		if (table_type_filter != "'%'") {
-			sql_duckdb_tables += "\n AND table_type IN (" + table_type_filter + ") ";
-		}
-	}
-
-	sql_duckdb_tables += "\n AND table_catalog NOT LIKE '__ducklake_%' ";
-
-	sql_duckdb_tables += "\n ORDER BY TABLE_TYPE, TABLE_CATALOG, TABLE_SCHEMA, TABLE_NAME";
-
-	return sql_duckdb_tables;
-}
-
 SQLUINTEGER OdbcUtils::SQLPointerToSQLUInteger(SQLPOINTER value) {
 	return static_cast<SQLUINTEGER>(reinterpret_cast<SQLULEN>(value));
 }
@@ -5,6 +5,10 @@
 
 #include <utility>
 
+#include "catalog_scan.hpp"
+#include "connection_pool.hpp"
+#include "insert_batch.hpp"
+#include "instance_keep_alive.hpp"
 #include "session_init.hpp"
 
 using namespace duckdb;
@@ -29,16 +33,34 @@ bool Connect::SetSuccessWithInfo(SQLRETURN ret) {
 	return true;
 }
 
+const Connect::OptionIndex &Connect::GetOptionIndex() {
+	static const OptionIndex index = []() {
+		OptionIndex result;
+		result.candidates = DBConfig::GetOptionNames();
+		result.names.insert(result.candidates.begin(), result.candidates.end());
+
+		// ODBC-local options
+		result.names.insert("database");
+		result.names.insert("dsn");
+		result.names.insert(SessionInit::SQL_FILE_OPTION);
+		result.names.insert(SessionInit::SQL_FILE_SHA256_OPTION);
+		result.names.insert(InsertBatch::BATCH_SIZE_OPTION);
+		result.names.insert(InstanceKeepAlive::IDLE_TTL_OPTION);
+		result.names.insert(CatalogNameFilter::EXCLUDE_CATALOGS_OPTION);
+		return result;
+	}();
+	return index;
+}
+
 SQLRETURN Connect::FindMatchingKey(const std::string &input, string &key) {
-	if (seen_config_options.find(input) != seen_config_options.end()) {
+	auto &index = GetOptionIndex();
+	if (index.names.find(input) != index.names.end()) {
 		key = input;
 		return SQL_SUCCESS;
 	}
 
-	auto config_names = DBConfig::GetOptionNames();
-
 	// If the input doesn't match a keyname, find a similar keyname
-	auto msg = StringUtil::CandidatesErrorMessage(config_names, input, "Did you mean: ");
+	auto msg = StringUtil::CandidatesErrorMessage(index.candidates, input, "Did you mean: ");
 	return SetDiagnosticRecord(dbc, SQL_SUCCESS_WITH_INFO, "SQLDriverConnect",
 	                           "Invalid keyword: '" + input + "'. " + msg, SQLStateType::ST_01S09, "");
 }
@@ -78,32 +100,25 @@ SQLRETURN Connect::FindKeyValPair(const std::string &row) {
 	std::string val = OdbcUtils::TrimString(val_spaces);
 
 	config_map[key] = val;
-	seen_config_options[key] = true;
 	return SQL_SUCCESS;
 }
 
 SQLRETURN Connect::ParseInputStr() {
-	size_t row_pos;
-	std::string row;
-
 	if (input_str.empty()) {
 		return SQL_SUCCESS;
 	}
 
-	while ((row_pos = input_str.find(ROW_DEL)) != std::string::npos) {
-		row = input_str.substr(0, row_pos);
-		SQLRETURN ret = FindKeyValPair(row);
-		if (!SetSuccessWithInfo(ret)) {
-			return ret;
+	idx_t row_start = 0;
+	while (row_start < input_str.size()) {
+		auto row_end = input_str.find(ROW_DEL, row_start);
+		if (row_end == std::string::npos) {
+			row_end = input_str.size();
 		}
-		input_str.erase(0, row_pos + 1);
-	}
-
-	if (!input_str.empty()) {
-		SQLRETURN ret = FindKeyValPair(input_str);
+		SQLRETURN ret = FindKeyValPair(input_str.substr(row_start, row_end - row_start));
 		if (!SetSuccessWithInfo(ret)) {
 			return ret;
 		}
+		row_start = row_end + 1;
 	}
 
 	// Extract the DSN from the config map as it is needed to read from the .odbc.ini file
@@ -119,23 +134,46 @@ SQLRETURN Connect::ReadFromIniFile() {
 	}
 
 	auto converted_dsn = OdbcUtils::ConvertStringToLPCSTR(dbc->dsn);
-	for (auto &key_pair : seen_config_options) {
-		// if the key has already been set, skip it
-		if (key_pair.second) {
+
+	// Without a key the names of all keys of the DSN section are returned, separated and terminated by '\0'
+	vector<char> key_names(1024);
+	int keys_size;
+	while (true) {
+		keys_size = SQLGetPrivateProfileString(converted_dsn, nullptr, "", key_names.data(),
+		                                       static_cast<int>(key_names.size()), "odbc.ini");
+		if (keys_size < 0) {
+			return SetDiagnosticRecord(dbc, SQL_ERROR, "SQLDriverConnect", "Error reading from .odbc.ini",
+			                           SQLStateType::ST_01S09, "");
+		}
+		// a truncated list fills the buffer, except for its terminators
+		if (idx_t(keys_size) + 2 < key_names.size()) {
+			break;
+		}
+		key_names.resize(key_names.size() * 2);
+	}
+
+	auto &index = GetOptionIndex();
+	idx_t key_start = 0;
+	while (key_start < idx_t(keys_size) && key_names[key_start] != '\0') {
+		std::string key_name(key_names.data() + key_start);
+		key_start += key_name.size() + 1;
+
+		auto key = StringUtil::Lower(OdbcUtils::TrimString(key_name));
+		// keys set in the connection string take precedence, keys unknown to the driver are skipped
+		if (config_map.find(key) != config_map.end() || index.names.find(key) == index.names.end()) {
 			continue;
 		}
 		const idx_t max_val_len = 256;
 		char char_val[max_val_len];
-		auto converted_key = key_pair.first.c_str();
-		int read_size = SQLGetPrivateProfileString(converted_dsn, converted_key, "", char_val, max_val_len, "odbc.ini");
+		int read_size =
+		    SQLGetPrivateProfileString(converted_dsn, key_name.c_str(), "", char_val, max_val_len, "odbc.ini");
 		if (read_size == 0) {
 			continue;
 		} else if (read_size < 0) {
 			return SetDiagnosticRecord(dbc, SQL_ERROR, "SQLDriverConnect", "Error reading from .odbc.ini",
 			                           SQLStateType::ST_01S09, "");
 		}
-		config_map[key_pair.first] = std::string(char_val);
-		seen_config_options[key_pair.first] = true;
+		config_map[key] = std::string(char_val);
 	}
 #endif
 	return SQL_SUCCESS;
@@ -164,17 +202,51 @@ SQLRETURN Connect::SetConnection() {
 	std::string session_init_sql_file_sha256 = GetOptionFromConfigMap(SessionInit::SQL_FILE_SHA256_OPTION);
 	SessionInitSQLFile session_init_content;
 
+	std::string insert_batching = GetOptionFromConfigMap(InsertBatch::BATCH_SIZE_OPTION);
+	std::string instance_idle_ttl = GetOptionFromConfigMap(InstanceKeepAlive::IDLE_TTL_OPTION);
+	dbc->metadata_excluded_catalogs =
+	    CatalogNameFilter::ParseCatalogList(GetOptionFromConfigMap(CatalogNameFilter::EXCLUDE_CATALOGS_OPTION));
+
+	// Computed before the ODBC-local options are removed, the session init file is part of the key
+	std::string pool_key = ConnectionPool::GetKey(*dbc, database, config_map);
+
 	// Remove ODBC-local options from the config map
 	config_map.erase("database");
 	config_map.erase("dsn");
 	config_map.erase(SessionInit::SQL_FILE_OPTION);
 	config_map.erase(SessionInit::SQL_FILE_SHA256_OPTION);
+	config_map.erase(InsertBatch::BATCH_SIZE_OPTION);
+	config_map.erase(InstanceKeepAlive::IDLE_TTL_OPTION);
+	config_map.erase(CatalogNameFilter::EXCLUDE_CATALOGS_OPTION);
 
 	// Remove 'enable_external_access' option because it is handled separately
 	config_map.erase("enable_external_access");
 
 	bool db_created = false;
 	try {
+		if (!insert_batching.empty()) {
+			auto batch_size = Value(insert_batching).DefaultCastAs(LogicalType::UBIGINT).GetValue<uint64_t>();
+			if (batch_size > BaseAppender::DEFAULT_FLUSH_COUNT) {
+				return SetDiagnosticRecord(dbc, SQL_ERROR, "SQLDriverConnect",
+				                           "Option '" + InsertBatch::BATCH_SIZE_OPTION + "' must not exceed " +
+				                               std::to_string(BaseAppender::DEFAULT_FLUSH_COUNT),
+				                           SQLStateType::ST_HY024, "");
+			}
+			dbc->insert_batch_size = batch_size;
+		}
+		idx_t idle_ttl_seconds = 0;
+		if (!instance_idle_ttl.empty()) {
+			idle_ttl_seconds = Value(instance_idle_ttl).DefaultCastAs(LogicalType::UBIGINT).GetValue<uint64_t>();
+		}
+
+		// Closes the kept alive instances that expired, the database may be reopened below
+		InstanceKeepAlive::Get().Sweep();
+
+		// A pooled connection was set up by an earlier connect, including its session init SQL
+		if (!pool_key.empty() && ConnectionPool::Get().Acquire(*dbc, pool_key)) {
+			return SQL_SUCCESS;
+		}
+
 		session_init_content = SessionInit::ReadSQLFile(session_init_sql_file, session_init_sql_file_sha256);
 
 		// Validate and set all options
@@ -184,17 +256,23 @@ SQLRETURN Connect::SetConnection() {
 			config.SetOptionByName("enable_external_access", duckdb::Value(enable_external_access));
 		}
 
-		bool cache_instance = database != IN_MEMORY_PATH;
+		// Without a 'threads' option DuckDB uses all hardware threads. The TaskScheduler belongs to the database
+		// instance, so the connections sharing a cached instance also share its threads.
+		// The cache keeps a named in-memory database alive while any connection references it.
+		bool cache_instance = !IsPrivateDatabase(database);
 
-		dbc->env->db = instance_cache.GetOrCreateInstance(database, config, cache_instance,
+		dbc->db = instance_cache.GetOrCreateInstance(database, config, cache_instance,
 		                                                  [&db_created](DuckDB &_) { db_created = true; });
+		if (cache_instance && idle_ttl_seconds > 0) {
+			InstanceKeepAlive::Get().Register(database, dbc->db, idle_ttl_seconds);
+		}
 	} catch (std::exception &ex) {
 		ErrorData error(ex);
 		return SetDiagnosticRecord(dbc, SQL_ERROR, "SQLDriverConnect", error.Message(), SQLStateType::ST_IM003, "");
 	}
 
 	if (!dbc->conn) {
-		dbc->conn = make_uniq<Connection>(*dbc->env->db);
+		dbc->conn = make_uniq<Connection>(*dbc->db);
 		dbc->conn->SetAutoCommit(dbc->autocommit);
 	}
 
@@ -204,6 +282,20 @@ SQLRETURN Connect::SetConnection() {
 		ret = SessionInit::Run(dbc, session_init_content, db_created);
 		if (!SQL_SUCCEEDED(ret)) {
 			dbc->conn.reset();
+			dbc->db.reset();
+			return ret;
+		}
+	}
+
+	if (!pool_key.empty()) {
+		try {
+			ConnectionPool::Get().Register(*dbc, pool_key);
+		} catch (std::exception &ex) {
+			ErrorData error(ex);
+			dbc->conn.reset();
+			dbc->db.reset();
+			return SetDiagnosticRecord(dbc, SQL_ERROR, "SQLDriverConnect", error.Message(), SQLStateType::ST_HY000,
+			                           "");
 		}
 	}
 
@@ -211,36 +303,25 @@ SQLRETURN Connect::SetConnection() {
 }
 
 Connect::Connect(OdbcHandleDbc *dbc_p, string input_str_p) : dbc(dbc_p), input_str(std::move(input_str_p)) {
-	// Get all the config options
-	auto config_options = DBConfig::GetOptionNames();
-	for (auto &option : config_options) {
-		// They are all set to false as they haven't been set yet
-		seen_config_options[option] = false;
-	}
-
-	// Register ODBC-local options
-	seen_config_options["database"] = false;
-	seen_config_options["dsn"] = false;
-	seen_config_options[SessionInit::SQL_FILE_OPTION] = false;
-	seen_config_options[SessionInit::SQL_FILE_SHA256_OPTION] = false;
-
 	// Required for settings like 'allowed_directories' that use
 	// file separator when checking the property value.
 	config.file_system = duckdb::make_uniq<duckdb::VirtualFileSystem>();
 }
 
 std::string Connect::GetOptionFromConfigMap(const std::string &option_name, const std::string &default_val) {
-	D_ASSERT(seen_config_options.count(option_name) == 1);
+	D_ASSERT(GetOptionIndex().names.count(option_name) == 1);
 
-	if (!seen_config_options[option_name]) {
+	auto it = config_map.find(option_name);
+	if (it == config_map.end()) {
 		return default_val;
 	}
-
-	auto it = config_map.find(option_name);
-	D_ASSERT(it != config_map.end());
 	return it->second.GetValue<std::string>();
 }
 
+bool Connect::IsPrivateDatabase(const std::string &database) {
+	return database.empty() || database == IN_MEMORY_PATH;
+}
+
 void Connect::NormalizeWindowsPathSeparators(const std::string &option_name) {
 #ifdef _WIN32
 	auto value_str = GetOptionFromConfigMap(option_name);
@@ -0,0 +1,203 @@
+#include "connection_pool.hpp"
+
+#include "connect.hpp"
+#include "insert_batch.hpp"
+
+#include "duckdb/catalog/catalog_entry/schema_catalog_entry.hpp"
+#include "duckdb/catalog/catalog_search_path.hpp"
+#include "duckdb/catalog/duck_catalog.hpp"
+#include "duckdb/main/attached_database.hpp"
+#include "duckdb/main/client_data.hpp"
+
+using duckdb::ConnectionPool;
+
+//! The catalog sets holding the objects a session can create in its temporary catalog, views are kept with the
+//! tables and macros with the functions
+static const duckdb::CatalogType TEMPORARY_OBJECT_TYPES[] = {
+    duckdb::CatalogType::TABLE_ENTRY, duckdb::CatalogType::SEQUENCE_ENTRY, duckdb::CatalogType::TYPE_ENTRY,
+    duckdb::CatalogType::SCALAR_FUNCTION_ENTRY, duckdb::CatalogType::TABLE_FUNCTION_ENTRY};
+
+ConnectionPool &ConnectionPool::Get() {
+	static ConnectionPool pool;
+	return pool;
+}
+
+std::string ConnectionPool::GetKey(OdbcHandleDbc &dbc, const string &database,
+                                   const case_insensitive_map_t<Value> &options) {
+	auto &env = *dbc.env;
+	if (env.connection_pooling == SQL_CP_OFF || Connect::IsPrivateDatabase(database)) {
+		return string();
+	}
+
+	string key;
+	if (env.connection_pooling == SQL_CP_ONE_PER_HENV) {
+		key += "henv=" + std::to_string(reinterpret_cast<uintptr_t>(&env)) + ";";
+	}
+	key += "database=" + database + ";";
+
+	// the options map is unordered, the keys are lower case already
+	map<string, string> sorted_options;
+	for (auto &option : options) {
+		if (option.first == "database") {
+			continue;
+		}
+		sorted_options[option.first] = option.second.ToString();
+	}
+	for (auto &option : sorted_options) {
+		key += option.first + "=" + option.second + ";";
+	}
+
+	// with SQL_CP_RELAXED_MATCH the autocommit mode is applied to the reused connection instead. The access mode
+	// is only reported back by SQLGetConnectAttr, it is kept on the handle and has nothing to apply.
+	if (env.cp_match == SQL_CP_STRICT_MATCH) {
+		key += "autocommit=" + std::to_string(dbc.autocommit) + ";";
+		key += "access_mode=" + std::to_string(dbc.sql_attr_access_mode) + ";";
+	}
+	return key;
+}
+
+bool ConnectionPool::Acquire(OdbcHandleDbc &dbc, const string &key) {
+	vector<IdleConnection> expired;
+	IdleConnection entry;
+	{
+		lock_guard<mutex> guard(lock);
+		RemoveExpired(expired);
+		auto it = idle.find(key);
+		if (it == idle.end()) {
+			misses++;
+			return false;
+		}
+		// the most recently released connection is the warmest one
+		entry = std::move(it->second.back());
+		it->second.pop_back();
+		if (it->second.empty()) {
+			idle.erase(it);
+		}
+		hits++;
+	}
+
+	dbc.db = entry.db;
+	dbc.conn = std::move(entry.conn);
+	dbc.conn->SetAutoCommit(dbc.autocommit);
+	dbc.pool_key = key;
+	dbc.pool_db = std::move(entry.db);
+	dbc.pool_config = std::move(entry.config);
+	return true;
+}
+
+void ConnectionPool::Register(OdbcHandleDbc &dbc, const string &key) {
+	D_ASSERT(dbc.conn);
+	dbc.pool_key = key;
+	dbc.pool_db = dbc.db;
+	dbc.pool_config = make_uniq<ClientConfig>(dbc.conn->context->config);
+}
+
+void ConnectionPool::Release(OdbcHandleDbc &dbc) {
+	D_ASSERT(!dbc.pool_key.empty() && dbc.pool_db && dbc.pool_config);
+	// statements left allocated by the application must not reach the connection once it is handed out again
+	for (auto stmt : dbc.vec_stmt_ref) {
+		stmt->Close();
+		stmt->stmt.reset();
+		stmt->insert_batch.reset();
+	}
+	IdleConnection entry;
+	entry.db = std::move(dbc.pool_db);
+	entry.conn = std::move(dbc.conn);
+	entry.config = std::move(dbc.pool_config);
+	auto key = std::move(dbc.pool_key);
+	dbc.pool_key.clear();
+
+	if (!entry.conn || !Reset(*entry.conn, *entry.config)) {
+		return;
+	}
+	entry.released_at = std::chrono::steady_clock::now();
+
+	vector<IdleConnection> expired;
+	lock_guard<mutex> guard(lock);
+	RemoveExpired(expired);
+	auto &entries = idle[key];
+	if (entries.size() < MAX_IDLE_PER_KEY) {
+		entries.push_back(std::move(entry));
+	} else {
+		expired.push_back(std::move(entry));
+	}
+}
+
+void ConnectionPool::Purge(OdbcHandleEnv &env) {
+	auto prefix = "henv=" + std::to_string(reinterpret_cast<uintptr_t>(&env)) + ";";
+	vector<IdleConnection> purged;
+	lock_guard<mutex> guard(lock);
+	for (auto it = idle.begin(); it != idle.end();) {
+		if (!StringUtil::StartsWith(it->first, prefix)) {
+			it++;
+			continue;
+		}
+		for (auto &entry : it->second) {
+			purged.push_back(std::move(entry));
+		}
+		it = idle.erase(it);
+	}
+}
+
+ConnectionPool::Metrics ConnectionPool::GetMetrics() {
+	lock_guard<mutex> guard(lock);
+	Metrics metrics {hits, misses, 0};
+	for (auto &entries : idle) {
+		metrics.idle += entries.second.size();
+	}
+	return metrics;
+}
+
+bool ConnectionPool::HasTemporaryObjects(ClientContext &context) {
+	// the transaction was rolled back, only committed entries are left. The internal entries are the built-in
+	// types, they are created on lookup in every catalog.
+	bool found = false;
+	auto &temp_catalog = ClientData::Get(context).temporary_objects->GetCatalog().Cast<DuckCatalog>();
+	temp_catalog.ScanSchemas([&](SchemaCatalogEntry &schema) {
+		for (auto type : TEMPORARY_OBJECT_TYPES) {
+			schema.Scan(type, [&](CatalogEntry &entry) { found = found || !entry.internal; });
+		}
+	});
+	return found;
+}
+
+bool ConnectionPool::Reset(Connection &conn, const ClientConfig &config) {
+	try {
+		if (conn.HasActiveTransaction()) {
+			conn.Rollback();
+		}
+		conn.SetAutoCommit(true);
+
+		auto &context = *conn.context;
+		if (HasTemporaryObjects(context)) {
+			return false;
+		}
+
+		auto &client_data = ClientData::Get(context);
+		client_data.prepared_statements.clear();
+		client_data.catalog_search_path->Reset();
+		context.config = config;
+	} catch (std::exception &ex) {
+		return false;
+	}
+	return true;
+}
+
+void ConnectionPool::RemoveExpired(vector<IdleConnection> &expired) {
+	auto deadline = std::chrono::steady_clock::now() - std::chrono::seconds(int64_t(IDLE_TIMEOUT_SECONDS));
+	for (auto it = idle.begin(); it != idle.end();) {
+		auto &entries = it->second;
+		// entries are ordered by release time
+		idx_t expired_count = 0;
+		while (expired_count < entries.size() && entries[expired_count].released_at < deadline) {
+			expired.push_back(std::move(entries[expired_count]));
+			expired_count++;
+		}
+		entries.erase(entries.begin(), entries.begin() + static_cast<int64_t>(expired_count));
+		if (entries.empty()) {
+			it = idle.erase(it);
+		} else {
+			it++;
+		}
+	}
+}
@@ -0,0 +1,87 @@
+#include "instance_keep_alive.hpp"
+
+#include "duckdb/common/file_system.hpp"
+#include "duckdb/main/connection_manager.hpp"
+#include "duckdb/storage/buffer_manager.hpp"
+
+#include <algorithm>
+
+using duckdb::InstanceKeepAlive;
+
+const std::string InstanceKeepAlive::IDLE_TTL_OPTION = "instance_idle_ttl_seconds";
+
+InstanceKeepAlive &InstanceKeepAlive::Get() {
+	static InstanceKeepAlive keep_alive;
+	return keep_alive;
+}
+
+void InstanceKeepAlive::Register(const string &database, shared_ptr<DuckDB> db, idx_t ttl_seconds) {
+	D_ASSERT(db);
+	lock_guard<mutex> guard(lock);
+	auto &instance = instances[database];
+	instance.db = std::move(db);
+	instance.ttl = std::chrono::seconds(static_cast<int64_t>(ttl_seconds));
+}
+
+void InstanceKeepAlive::Sweep() {
+	vector<shared_ptr<DuckDB>> to_checkpoint;
+	vector<shared_ptr<DuckDB>> to_close;
+	{
+		lock_guard<mutex> guard(lock);
+		auto now = std::chrono::steady_clock::now();
+		vector<std::pair<std::chrono::steady_clock::time_point, string>> idle_instances;
+		idx_t idle_memory = 0;
+		for (auto it = instances.begin(); it != instances.end();) {
+			auto &instance = it->second;
+			auto &db_instance = *instance.db->instance;
+			if (db_instance.GetConnectionManager().GetConnectionCount() > 0) {
+				instance.idle = false;
+				it++;
+				continue;
+			}
+			if (!instance.idle) {
+				instance.idle = true;
+				instance.idle_since = now;
+				to_checkpoint.push_back(instance.db);
+			} else if (now - instance.idle_since >= instance.ttl) {
+				to_close.push_back(std::move(instance.db));
+				it = instances.erase(it);
+				continue;
+			}
+			idle_instances.emplace_back(instance.idle_since, it->first);
+			idle_memory += BufferManager::GetBufferManager(db_instance).GetUsedMemory();
+			it++;
+		}
+
+		// on memory pressure the instances idle for the longest time are closed first
+		auto available_memory = FileSystem::GetAvailableMemory();
+		if (available_memory.IsValid()) {
+			auto idle_memory_limit = available_memory.GetIndex() / 100 * IDLE_MEMORY_SHARE_PERCENTAGE;
+			std::sort(idle_instances.begin(), idle_instances.end());
+			for (auto &idle_instance : idle_instances) {
+				if (idle_memory <= idle_memory_limit) {
+					break;
+				}
+				auto entry = instances.find(idle_instance.second);
+				auto &db_instance = *entry->second.db->instance;
+				idle_memory -= BufferManager::GetBufferManager(db_instance).GetUsedMemory();
+				to_close.push_back(std::move(entry->second.db));
+				instances.erase(entry);
+			}
+		}
+	}
+
+	// checkpointing and closing write to the database files, this is done without holding the lock
+	for (auto &db : to_checkpoint) {
+		Checkpoint(*db);
+	}
+}
+
+void InstanceKeepAlive::Checkpoint(DuckDB &db) {
+	try {
+		Connection conn(db);
+		conn.Query("CHECKPOINT");
+	} catch (std::exception &ex) {
+		// the checkpoint only shortens the WAL replay, read-only databases and concurrent writers are fine
+	}
+}
@@ -1,6 +1,6 @@
 #include "session_init.hpp"
 
-#include <regex>
+#include <cctype>
 #include <string>
 #include <vector>
 
@@ -12,13 +12,50 @@
 namespace duckdb {
 
 const size_t SessionInitSQLFile::SQL_FILE_MAX_SIZE_BYTES = 1 << 20; // 1MB
-const std::string SessionInitSQLFile::CONN_INIT_MARKER = "/\\*\\s*DUCKDB_CONNECTION_INIT_BELOW_MARKER\\s*\\*/";
+// any whitespace is accepted around the name, see MatchMarker
+const std::string SessionInitSQLFile::CONN_INIT_MARKER = "/* DUCKDB_CONNECTION_INIT_BELOW_MARKER */";
+
+//! Returns the end of the connection init marker comment that starts at pos, or npos when there is none
+static size_t MatchMarker(const std::string &str, size_t pos) {
+	static const std::string MARKER_NAME = "DUCKDB_CONNECTION_INIT_BELOW_MARKER";
+	auto skip_spaces = [&](size_t &p) {
+		while (p < str.size() && std::isspace(static_cast<unsigned char>(str[p]))) {
+			p++;
+		}
+	};
+	if (str.compare(pos, 2, "/*") != 0) {
+		return std::string::npos;
+	}
+	pos += 2;
+	skip_spaces(pos);
+	if (str.compare(pos, MARKER_NAME.size(), MARKER_NAME) != 0) {
+		return std::string::npos;
+	}
+	pos += MARKER_NAME.size();
+	skip_spaces(pos);
+	if (str.compare(pos, 2, "*/") != 0) {
+		return std::string::npos;
+	}
+	return pos + 2;
+}
 
+//! Splits the text at every connection init marker, an empty text after the last marker is dropped
 static std::vector<std::string> SplitByMarker(const std::string &str) {
-	std::regex regex(SessionInitSQLFile::CONN_INIT_MARKER);
-	std::sregex_token_iterator first(str.begin(), str.end(), regex, -1);
-	std::sregex_token_iterator last;
-	return std::vector<std::string>(first, last);
+	std::vector<std::string> parts;
+	size_t part_start = 0;
+	for (size_t pos = str.find("/*"); pos != std::string::npos; pos = str.find("/*", pos + 1)) {
+		auto marker_end = MatchMarker(str, pos);
+		if (marker_end == std::string::npos) {
+			continue;
+		}
+		parts.push_back(str.substr(part_start, pos - part_start));
+		part_start = marker_end;
+		pos = marker_end - 1;
+	}
+	if (parts.empty() || part_start < str.size()) {
+		parts.push_back(str.substr(part_start));
+	}
+	return parts;
 }
 
 SessionInitSQLFile::SessionInitSQLFile() {
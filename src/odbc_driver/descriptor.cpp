@@ -58,6 +58,15 @@ SQLRETURN OdbcHandleDesc::ReturnInvalidFieldIdentifier(bool is_readonly) {
 
 SQLRETURN OdbcHandleDesc::SetDescField(SQLSMALLINT rec_number, SQLSMALLINT field_identifier, SQLPOINTER value_ptr,
                                        SQLINTEGER buffer_length) {
+	// the result columns described for the parameter types of the statements using this APD or IPD may change
+	if (dbc) {
+		for (auto hstmt : dbc->vec_stmt_ref) {
+			if (hstmt->param_desc->GetAPD() == this || hstmt->param_desc->GetIPD() == this) {
+				hstmt->ird_param_types_valid = false;
+			}
+		}
+	}
+
 	// descriptor header fields
 	switch (field_identifier) {
 	case SQL_DESC_ALLOC_TYPE: {
@@ -348,12 +357,11 @@ SQLRETURN DescRecord::SetSqlDataType(SQLSMALLINT type) {
 }
 
 SQLRETURN DescRecord::SetSqlDescType(SQLSMALLINT type) {
-	vector<duckdb::OdbcTypeInfo> vec_typeinfo;
-	ApiInfo::FindDataType(type, vec_typeinfo);
-	if (vec_typeinfo.empty()) {
+	auto type_info_ptr = ApiInfo::FindFirstDataType(type);
+	if (!type_info_ptr) {
 		return SQL_ERROR; // handled
 	}
-	auto type_info = vec_typeinfo.front();
+	auto &type_info = *type_info_ptr;
 	// for consistency check set all other fields according to the first returned OdbcTypeInfo
 	SetSqlDataType(type_info.sql_data_type);
 
@@ -1,5 +1,6 @@
 #include "driver.hpp"
 
+#include "connection_pool.hpp"
 #include "duckdb/main/config.hpp"
 #include "duckdb/main/db_instance_cache.hpp"
 #include "duckdb_odbc.hpp"
@@ -35,11 +36,20 @@ SQLRETURN duckdb::FreeHandle(SQLSMALLINT handle_type, SQLHANDLE handle) {
 	}
 	case SQL_HANDLE_ENV: {
 		auto *hdl = static_cast<duckdb::OdbcHandleEnv *>(handle);
+		if (hdl->connection_pooling == SQL_CP_ONE_PER_HENV) {
+			ConnectionPool::Get().Purge(*hdl);
+		}
 		delete hdl;
 		return SQL_SUCCESS;
 	}
 	case SQL_HANDLE_STMT: {
 		auto *hdl = static_cast<duckdb::OdbcHandleStmt *>(handle);
+		if (hdl->dbc->insert_batch_stmt == hdl) {
+			SQLRETURN ret = hdl->dbc->FlushInsertBatch(hdl);
+			if (ret != SQL_SUCCESS) {
+				return ret;
+			}
+		}
 		hdl->dbc->EraseStmtRef(hdl);
 		delete hdl;
 		return SQL_SUCCESS;
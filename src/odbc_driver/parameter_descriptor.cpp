@@ -6,6 +6,7 @@
 #include "widechar.hpp"
 
 using duckdb::Decimal;
+using duckdb::LogicalType;
 using duckdb::OdbcHandleDesc;
 using duckdb::ParameterDescriptor;
 using duckdb::Value;
@@ -90,6 +91,39 @@ SQLRETURN ParameterDescriptor::GetParamValues(vector<Value> &values) {
 	return SetParamIndex();
 }
 
+duckdb::idx_t ParameterDescriptor::GetParamSetIndex() {
+	return paramset_idx;
+}
+
+bool ParameterDescriptor::PreconvertParamSet(idx_t set_idx, PreconvertedParamSet &set) {
+	set.set_idx = set_idx;
+	set.values.clear();
+	set.nts_lengths.clear();
+	for (idx_t rec_idx = 0; rec_idx < ipd->records.size(); ++rec_idx) {
+		Value value;
+		SQLLEN nts_length = SQL_NTS;
+		if (ConvertValue(rec_idx, set_idx, value, nts_length) != SQL_PARAM_SUCCESS) {
+			return false;
+		}
+		set.values.push_back(std::move(value));
+		set.nts_lengths.push_back(nts_length);
+	}
+	return true;
+}
+
+SQLRETURN ParameterDescriptor::UsePreconvertedParamSet(PreconvertedParamSet &set, vector<Value> &values) {
+	D_ASSERT(set.set_idx == paramset_idx && set.values.size() == ipd->records.size());
+	for (idx_t rec_idx = 0; rec_idx < set.values.size(); ++rec_idx) {
+		SetNTSLength(rec_idx, paramset_idx, set.nts_lengths[rec_idx]);
+		SetValue(set.values[rec_idx], rec_idx);
+	}
+	if (ipd->header.sql_desc_array_status_ptr) {
+		ipd->header.sql_desc_array_status_ptr[paramset_idx] = SQL_PARAM_SUCCESS;
+	}
+	values = std::move(set.values);
+	return SetParamIndex();
+}
+
 void ParameterDescriptor::SetParamProcessedPtr(SQLULEN *value_ptr) {
 	ipd->header.sql_desc_rows_processed_ptr = value_ptr;
 	if (ipd->header.sql_desc_rows_processed_ptr) {
@@ -235,7 +269,24 @@ SQLRETURN ParameterDescriptor::FillCurParamCharSet(DescRecord &apd_record, DescR
 }
 
 SQLRETURN ParameterDescriptor::SetValue(idx_t rec_idx) {
-	auto val_idx = paramset_idx;
+	Value value;
+	SQLLEN nts_length = SQL_NTS;
+	auto ret = ConvertValue(rec_idx, paramset_idx, value, nts_length);
+	if (ret != SQL_PARAM_SUCCESS) {
+		return ret;
+	}
+	SetNTSLength(rec_idx, paramset_idx, nts_length);
+	SetValue(value, rec_idx);
+	return ret;
+}
+
+void ParameterDescriptor::SetNTSLength(idx_t rec_idx, idx_t val_idx, SQLLEN nts_length) {
+	if (nts_length != SQL_NTS) {
+		*GetSQLDescIndicatorPtr(cur_apd->records[rec_idx], val_idx) = nts_length;
+	}
+}
+
+SQLRETURN ParameterDescriptor::ConvertValue(idx_t rec_idx, idx_t val_idx, Value &value, SQLLEN &nts_length) {
 	auto apd_record = &cur_apd->records[rec_idx];
 	auto sql_data_ptr = GetSQLDescDataPtr(*apd_record);
 	auto sql_ind_ptr = GetSQLDescIndicatorPtr(*apd_record);
@@ -246,9 +297,8 @@ SQLRETURN ParameterDescriptor::SetValue(idx_t rec_idx) {
 
 	auto sql_ind_ptr_val_set = GetSQLDescIndicatorPtr(*apd_record, val_idx);
 	if (sql_data_ptr == nullptr || sql_ind_ptr == nullptr || *sql_ind_ptr_val_set == SQL_NULL_DATA) {
-		Value val_null(nullptr);
-		SetValue(val_null, rec_idx);
-		return SQL_SUCCESS;
+		value = Value(nullptr);
+		return SQL_PARAM_SUCCESS;
 	}
 
 	if (*sql_ind_ptr_val_set == SQL_DATA_AT_EXEC ||
@@ -256,7 +306,6 @@ SQLRETURN ParameterDescriptor::SetValue(idx_t rec_idx) {
 		return SQL_NEED_DATA;
 	}
 
-	duckdb::Value value;
 	// TODO need to check it param_value_ptr is an array of parameters
 	// and get the right parameter using the index (now it's working for all supported tests)
 	duckdb::const_data_ptr_t dataptr = (duckdb::const_data_ptr_t)sql_data_ptr;
@@ -268,10 +317,11 @@ SQLRETURN ParameterDescriptor::SetValue(idx_t rec_idx) {
 		auto buff_size = duckdb::MaxValue((SQLLEN)ipd->records[rec_idx].sql_desc_length,
 		                                  apd->records[rec_idx].sql_desc_octet_length);
 		auto str_data = (char *)sql_data_ptr + (val_idx * buff_size);
-		if (*sql_ind_ptr_val_set == SQL_NTS) {
-			*sql_ind_ptr_val_set = strlen(str_data);
-		}
 		auto str_len = *sql_ind_ptr_val_set;
+		if (str_len == SQL_NTS) {
+			str_len = static_cast<SQLLEN>(strlen(str_data));
+			nts_length = str_len;
+		}
 		value = Value(duckdb::OdbcUtils::ConvertSQLCHARToString(reinterpret_cast<SQLCHAR *>(str_data), str_len));
 		break;
 	}
@@ -281,13 +331,16 @@ SQLRETURN ParameterDescriptor::SetValue(idx_t rec_idx) {
 		auto buff_size = duckdb::MaxValue((SQLLEN)ipd->records[rec_idx].sql_desc_length,
 		                                  apd->records[rec_idx].sql_desc_octet_length);
 		auto utf16_data = (SQLWCHAR *)sql_data_ptr + (val_idx * buff_size);
+		auto utf16_len = *sql_ind_ptr_val_set == SQL_NTS
+		                     ? SQL_NTS
+		                     : static_cast<SQLLEN>(*sql_ind_ptr_val_set / static_cast<SQLLEN>(sizeof(SQLWCHAR)));
+		// the NTS length is found while converting, the string is then moved into the value
+		std::string utf8_str;
+		auto utf16_read = duckdb::widechar::utf16_to_utf8(utf16_data, utf16_len, utf8_str);
 		if (*sql_ind_ptr_val_set == SQL_NTS) {
-			*sql_ind_ptr_val_set = static_cast<SQLLEN>(duckdb::widechar::utf16_length(utf16_data) * sizeof(SQLWCHAR));
+			nts_length = static_cast<SQLLEN>(utf16_read * sizeof(SQLWCHAR));
 		}
-		auto utf16_len = static_cast<size_t>(*sql_ind_ptr_val_set / sizeof(SQLWCHAR));
-		auto utf8_vec = duckdb::widechar::utf16_to_utf8_lenient(utf16_data, utf16_len);
-		auto utf8_str = std::string(reinterpret_cast<char *>(utf8_vec.data()), utf8_vec.size());
-		value = Value(utf8_str);
+		value = Value(std::move(utf8_str));
 		break;
 	}
 	case SQL_BINARY:
@@ -384,11 +437,71 @@ SQLRETURN ParameterDescriptor::SetValue(idx_t rec_idx) {
 		// TODO error message?
 		return SQL_PARAM_ERROR;
 	}
-
-	SetValue(value, rec_idx);
 	return SQL_PARAM_SUCCESS;
 }
 
+bool ParameterDescriptor::GetDeclaredType(idx_t rec_idx, LogicalType &type) {
+	if (rec_idx >= ipd->records.size() || rec_idx >= cur_apd->records.size()) {
+		return false;
+	}
+	auto &ipd_record = ipd->records[rec_idx];
+	auto c_type = cur_apd->records[rec_idx].sql_desc_type;
+	// the types of the values made by SetValue
+	switch (ipd_record.sql_desc_type) {
+	case SQL_CHAR:
+	case SQL_VARCHAR:
+	case SQL_LONGVARCHAR:
+	case SQL_WCHAR:
+	case SQL_WVARCHAR:
+	case SQL_WLONGVARCHAR:
+		type = LogicalType::VARCHAR;
+		return true;
+	case SQL_BINARY:
+	case SQL_VARBINARY:
+	case SQL_LONGVARBINARY:
+		type = LogicalType::BLOB;
+		return true;
+	case SQL_TINYINT:
+		type = c_type == SQL_C_UTINYINT ? LogicalType::UTINYINT : LogicalType::TINYINT;
+		return true;
+	case SQL_SMALLINT:
+		type = c_type == SQL_C_USHORT ? LogicalType::USMALLINT : LogicalType::SMALLINT;
+		return true;
+	case SQL_INTEGER:
+		type = c_type == SQL_C_ULONG ? LogicalType::UINTEGER : LogicalType::INTEGER;
+		return true;
+	case SQL_BIGINT:
+		type = c_type == SQL_C_UBIGINT ? LogicalType::UBIGINT : LogicalType::BIGINT;
+		return true;
+	case SQL_FLOAT:
+		type = LogicalType::FLOAT;
+		return true;
+	case SQL_DOUBLE:
+		type = LogicalType::DOUBLE;
+		return true;
+	case SQL_NUMERIC: {
+		auto precision = ipd_record.sql_desc_precision;
+		auto scale = ipd_record.sql_desc_scale;
+		if (ValidateNumeric(precision, scale) == SQL_ERROR) {
+			return false;
+		}
+		type = LogicalType::DECIMAL(static_cast<uint8_t>(precision), static_cast<uint8_t>(scale));
+		return true;
+	}
+	case SQL_TYPE_TIMESTAMP:
+		type = LogicalType::TIMESTAMP;
+		return true;
+	case SQL_TYPE_DATE:
+		type = LogicalType::DATE;
+		return true;
+	case SQL_TYPE_TIME:
+		type = LogicalType::TIME;
+		return true;
+	default:
+		return false;
+	}
+}
+
 void ParameterDescriptor::SetValue(Value &value, idx_t val_idx) {
 	if (val_idx >= values.size()) {
 		values.emplace_back(value);
@@ -0,0 +1,506 @@
+#include "statement_functions.hpp"
+#include "handle_functions.hpp"
+#include "row_descriptor.hpp"
+#include "widechar.hpp"
+
+#include "duckdb/common/types/date.hpp"
+#include "duckdb/common/types/time.hpp"
+#include "duckdb/common/types/timestamp.hpp"
+#include "duckdb/main/appender.hpp"
+#include "duckdb/parser/keyword_helper.hpp"
+#include "duckdb/parser/expression/columnref_expression.hpp"
+#include "duckdb/parser/expression/star_expression.hpp"
+#include "duckdb/parser/parser.hpp"
+#include "duckdb/parser/query_node/select_node.hpp"
+#include "duckdb/parser/statement/select_statement.hpp"
+#include "duckdb/parser/tableref/basetableref.hpp"
+
+using duckdb::Appender;
+using duckdb::data_ptr_t;
+using duckdb::DataChunk;
+using duckdb::Date;
+using duckdb::FlatVector;
+using duckdb::idx_t;
+using duckdb::LogicalType;
+using duckdb::OdbcBoundCol;
+using duckdb::OdbcHandleStmt;
+using duckdb::SQLStateType;
+using duckdb::string;
+using duckdb::StringVector;
+using duckdb::Time;
+using duckdb::Timestamp;
+using duckdb::vector;
+
+//! The table behind a single-table SELECT cursor, and the table column of every result column
+struct BulkAddTarget {
+	string catalog;
+	string schema;
+	string table;
+	vector<string> column_names;
+};
+
+//! The bound application buffers of a result column
+struct BulkAddColumn {
+	BulkAddColumn(OdbcBoundCol &bound_col_p, idx_t col_idx_p, LogicalType type_p, idx_t value_size)
+	    : bound_col(bound_col_p), col_idx(col_idx_p), type(std::move(type_p)), value_stride(value_size),
+	      ind_stride(sizeof(SQLLEN)) {
+	}
+
+	data_ptr_t ValuePtr(idx_t row) const {
+		return reinterpret_cast<data_ptr_t>(bound_col.ptr) + bind_offset + row * value_stride;
+	}
+
+	SQLLEN *IndicatorPtr(idx_t row) const {
+		if (!bound_col.strlen_or_ind) {
+			return nullptr;
+		}
+		return reinterpret_cast<SQLLEN *>(reinterpret_cast<data_ptr_t>(bound_col.strlen_or_ind) + bind_offset +
+		                                  row * ind_stride);
+	}
+
+	bool IsNull(idx_t row) const {
+		auto ind_ptr = IndicatorPtr(row);
+		return ind_ptr && *ind_ptr == SQL_NULL_DATA;
+	}
+
+	bool IsIgnored(idx_t row) const {
+		auto ind_ptr = IndicatorPtr(row);
+		return ind_ptr && *ind_ptr == SQL_COLUMN_IGNORE;
+	}
+
+	OdbcBoundCol &bound_col;
+	idx_t col_idx;
+	LogicalType type;
+	idx_t value_stride;
+	idx_t ind_stride;
+	idx_t bind_offset = 0;
+};
+
+//! The rows of the rowset that ignore the same columns, they are inserted without these columns so that the
+//! columns get their default values
+struct BulkAddRowGroup {
+	vector<bool> ignored;
+	vector<idx_t> rows;
+};
+
+//! Only cursors over a plain 'SELECT cols FROM table ...' can insert rows, joins, aggregates, set operations
+//! and computed columns have no single row of a table to add to
+static bool GetBulkAddTarget(OdbcHandleStmt *hstmt, BulkAddTarget &target) {
+	duckdb::Parser parser;
+	try {
+		parser.ParseQuery(hstmt->stmt->query);
+	} catch (std::exception &ex) {
+		return false;
+	}
+	if (parser.statements.size() != 1 || parser.statements[0]->type != duckdb::StatementType::SELECT_STATEMENT) {
+		return false;
+	}
+	auto &select = parser.statements[0]->Cast<duckdb::SelectStatement>();
+	if (select.node->type != duckdb::QueryNodeType::SELECT_NODE || !select.node->cte_map.map.empty()) {
+		return false;
+	}
+	auto &node = select.node->Cast<duckdb::SelectNode>();
+	if (!node.from_table || node.from_table->type != duckdb::TableReferenceType::BASE_TABLE ||
+	    !node.groups.group_expressions.empty() || !node.groups.grouping_sets.empty() || node.having || node.qualify ||
+	    node.aggregate_handling != duckdb::AggregateHandling::STANDARD_HANDLING) {
+		return false;
+	}
+	for (auto &modifier : node.modifiers) {
+		if (modifier->type == duckdb::ResultModifierType::DISTINCT_MODIFIER) {
+			return false;
+		}
+	}
+
+	auto &table_ref = node.from_table->Cast<duckdb::BaseTableRef>();
+	target.catalog = table_ref.catalog_name;
+	target.schema = table_ref.schema_name;
+	target.table = table_ref.table_name;
+	target.column_names.clear();
+
+	if (node.select_list.size() == 1 && node.select_list[0]->GetExpressionClass() == duckdb::ExpressionClass::STAR) {
+		auto &star = node.select_list[0]->Cast<duckdb::StarExpression>();
+		if (star.columns || star.expr || !star.exclude_list.empty() || !star.replace_list.empty() ||
+		    !star.rename_list.empty()) {
+			return false;
+		}
+		target.column_names = hstmt->stmt->GetNames();
+		return true;
+	}
+	for (auto &expr : node.select_list) {
+		if (expr->GetExpressionClass() != duckdb::ExpressionClass::COLUMN_REF) {
+			return false;
+		}
+		target.column_names.push_back(expr->Cast<duckdb::ColumnRefExpression>().GetColumnName());
+	}
+	return target.column_names.size() == hstmt->stmt->ColumnCount();
+}
+
+//! The type the bound C buffers are read as, the Appender casts it to the column type.
+//! Returns false for C types that cannot be bulk inserted
+static bool GetBulkAddType(OdbcBoundCol &bound_col, LogicalType &type, idx_t &value_size) {
+	switch (bound_col.type) {
+	case SQL_C_CHAR:
+	case SQL_C_WCHAR:
+		type = LogicalType::VARCHAR;
+		value_size = bound_col.len;
+		return true;
+	case SQL_C_BINARY:
+		type = LogicalType::BLOB;
+		value_size = bound_col.len;
+		return true;
+	case SQL_C_BIT:
+		type = LogicalType::BOOLEAN;
+		value_size = sizeof(uint8_t);
+		return true;
+	case SQL_C_TINYINT:
+	case SQL_C_STINYINT:
+		type = LogicalType::TINYINT;
+		value_size = sizeof(int8_t);
+		return true;
+	case SQL_C_UTINYINT:
+		type = LogicalType::UTINYINT;
+		value_size = sizeof(uint8_t);
+		return true;
+	case SQL_C_SHORT:
+	case SQL_C_SSHORT:
+		type = LogicalType::SMALLINT;
+		value_size = sizeof(int16_t);
+		return true;
+	case SQL_C_USHORT:
+		type = LogicalType::USMALLINT;
+		value_size = sizeof(uint16_t);
+		return true;
+	case SQL_C_LONG:
+	case SQL_C_SLONG:
+		type = LogicalType::INTEGER;
+		value_size = sizeof(int32_t);
+		return true;
+	case SQL_C_ULONG:
+		type = LogicalType::UINTEGER;
+		value_size = sizeof(uint32_t);
+		return true;
+	case SQL_C_SBIGINT:
+		type = LogicalType::BIGINT;
+		value_size = sizeof(int64_t);
+		return true;
+	case SQL_C_UBIGINT:
+		type = LogicalType::UBIGINT;
+		value_size = sizeof(uint64_t);
+		return true;
+	case SQL_C_FLOAT:
+		type = LogicalType::FLOAT;
+		value_size = sizeof(float);
+		return true;
+	case SQL_C_DOUBLE:
+		type = LogicalType::DOUBLE;
+		value_size = sizeof(double);
+		return true;
+	case SQL_C_TYPE_DATE:
+	case SQL_C_DATE:
+		type = LogicalType::DATE;
+		value_size = sizeof(SQL_DATE_STRUCT);
+		return true;
+	case SQL_C_TYPE_TIME:
+	case SQL_C_TIME:
+		type = LogicalType::TIME;
+		value_size = sizeof(SQL_TIME_STRUCT);
+		return true;
+	case SQL_C_TYPE_TIMESTAMP:
+	case SQL_C_TIMESTAMP:
+		type = LogicalType::TIMESTAMP;
+		value_size = sizeof(SQL_TIMESTAMP_STRUCT);
+		return true;
+	default:
+		return false;
+	}
+}
+
+template <class SRC, class DST = SRC>
+static void ReadFixedColumn(const BulkAddColumn &column, duckdb::Vector &result, const idx_t *rows, idx_t count) {
+	auto data = FlatVector::GetData<DST>(result);
+	auto &validity = FlatVector::Validity(result);
+	for (idx_t i = 0; i < count; i++) {
+		if (column.IsNull(rows[i])) {
+			validity.SetInvalid(i);
+			continue;
+		}
+		data[i] = static_cast<DST>(duckdb::Load<SRC>(column.ValuePtr(rows[i])));
+	}
+}
+
+static void ReadStringColumn(const BulkAddColumn &column, duckdb::Vector &result, const idx_t *rows, idx_t count) {
+	auto data = FlatVector::GetData<duckdb::string_t>(result);
+	auto &validity = FlatVector::Validity(result);
+	// reused for the conversion of wide strings
+	std::string utf8_buffer;
+	for (idx_t i = 0; i < count; i++) {
+		auto row = rows[i];
+		if (column.IsNull(row)) {
+			validity.SetInvalid(i);
+			continue;
+		}
+		auto ind_ptr = column.IndicatorPtr(row);
+		auto value_ptr = column.ValuePtr(row);
+		switch (column.bound_col.type) {
+		case SQL_C_CHAR: {
+			auto str = reinterpret_cast<const char *>(value_ptr);
+			auto len = (!ind_ptr || *ind_ptr == SQL_NTS) ? strlen(str) : static_cast<size_t>(*ind_ptr);
+			data[i] = StringVector::AddString(result, str, len);
+			break;
+		}
+		case SQL_C_WCHAR: {
+			auto utf16_str = reinterpret_cast<const SQLWCHAR *>(value_ptr);
+			auto utf16_len =
+			    (!ind_ptr || *ind_ptr == SQL_NTS) ? SQL_NTS : *ind_ptr / static_cast<SQLLEN>(sizeof(SQLWCHAR));
+			duckdb::widechar::utf16_to_utf8(utf16_str, utf16_len, utf8_buffer);
+			data[i] = StringVector::AddString(result, utf8_buffer.data(), utf8_buffer.size());
+			break;
+		}
+		default: {
+			auto len = ind_ptr ? static_cast<size_t>(*ind_ptr) : static_cast<size_t>(column.bound_col.len);
+			data[i] = StringVector::AddStringOrBlob(result, reinterpret_cast<const char *>(value_ptr), len);
+			break;
+		}
+		}
+	}
+}
+
+static void ReadTemporalColumn(const BulkAddColumn &column, duckdb::Vector &result, const idx_t *rows, idx_t count) {
+	auto &validity = FlatVector::Validity(result);
+	for (idx_t i = 0; i < count; i++) {
+		auto row = rows[i];
+		if (column.IsNull(row)) {
+			validity.SetInvalid(i);
+			continue;
+		}
+		auto value_ptr = column.ValuePtr(row);
+		switch (column.type.id()) {
+		case duckdb::LogicalTypeId::DATE: {
+			auto date = duckdb::Load<SQL_DATE_STRUCT>(value_ptr);
+			FlatVector::GetData<duckdb::date_t>(result)[i] = Date::FromDate(date.year, date.month, date.day);
+			break;
+		}
+		case duckdb::LogicalTypeId::TIME: {
+			auto time = duckdb::Load<SQL_TIME_STRUCT>(value_ptr);
+			FlatVector::GetData<duckdb::dtime_t>(result)[i] = Time::FromTime(time.hour, time.minute, time.second);
+			break;
+		}
+		default: {
+			auto ts = duckdb::Load<SQL_TIMESTAMP_STRUCT>(value_ptr);
+			// the fraction is in nanoseconds
+			auto time = Time::FromTime(ts.hour, ts.minute, ts.second, static_cast<int32_t>(ts.fraction / 1000));
+			FlatVector::GetData<duckdb::timestamp_t>(result)[i] =
+			    Timestamp::FromDatetime(Date::FromDate(ts.year, ts.month, ts.day), time);
+			break;
+		}
+		}
+	}
+}
+
+static void ReadColumn(const BulkAddColumn &column, duckdb::Vector &result, const idx_t *rows, idx_t count) {
+	switch (column.bound_col.type) {
+	case SQL_C_CHAR:
+	case SQL_C_WCHAR:
+	case SQL_C_BINARY:
+		ReadStringColumn(column, result, rows, count);
+		break;
+	case SQL_C_BIT:
+		ReadFixedColumn<uint8_t, bool>(column, result, rows, count);
+		break;
+	case SQL_C_TINYINT:
+	case SQL_C_STINYINT:
+		ReadFixedColumn<int8_t>(column, result, rows, count);
+		break;
+	case SQL_C_UTINYINT:
+		ReadFixedColumn<uint8_t>(column, result, rows, count);
+		break;
+	case SQL_C_SHORT:
+	case SQL_C_SSHORT:
+		ReadFixedColumn<int16_t>(column, result, rows, count);
+		break;
+	case SQL_C_USHORT:
+		ReadFixedColumn<uint16_t>(column, result, rows, count);
+		break;
+	case SQL_C_LONG:
+	case SQL_C_SLONG:
+		ReadFixedColumn<int32_t>(column, result, rows, count);
+		break;
+	case SQL_C_ULONG:
+		ReadFixedColumn<uint32_t>(column, result, rows, count);
+		break;
+	case SQL_C_SBIGINT:
+		ReadFixedColumn<int64_t>(column, result, rows, count);
+		break;
+	case SQL_C_UBIGINT:
+		ReadFixedColumn<uint64_t>(column, result, rows, count);
+		break;
+	case SQL_C_FLOAT:
+		ReadFixedColumn<float>(column, result, rows, count);
+		break;
+	case SQL_C_DOUBLE:
+		ReadFixedColumn<double>(column, result, rows, count);
+		break;
+	default:
+		ReadTemporalColumn(column, result, rows, count);
+		break;
+	}
+}
+
+//! Insert the rows of a group, the columns they ignore are left out so that they get their default values
+static void AppendRowGroup(duckdb::Connection &conn, const BulkAddTarget &target,
+                           const vector<BulkAddColumn> &columns, const BulkAddRowGroup &group) {
+	vector<idx_t> active_columns;
+	for (idx_t i = 0; i < columns.size(); i++) {
+		if (!group.ignored[i]) {
+			active_columns.push_back(i);
+		}
+	}
+	if (active_columns.empty()) {
+		// the Appender needs at least one column, every column of these rows gets its default value
+		auto table = duckdb::KeywordHelper::WriteOptionallyQuoted(target.table);
+		if (!target.schema.empty()) {
+			table = duckdb::KeywordHelper::WriteOptionallyQuoted(target.schema) + "." + table;
+		}
+		if (!target.catalog.empty()) {
+			table = duckdb::KeywordHelper::WriteOptionallyQuoted(target.catalog) + "." + table;
+		}
+		for (idx_t i = 0; i < group.rows.size(); i++) {
+			auto result = conn.Query("INSERT INTO " + table + " DEFAULT VALUES");
+			if (result->HasError()) {
+				result->ThrowError();
+			}
+		}
+		return;
+	}
+
+	Appender appender(conn, target.catalog, target.schema, target.table);
+	vector<LogicalType> types;
+	for (auto col : active_columns) {
+		appender.AddColumn(target.column_names[columns[col].col_idx]);
+		types.push_back(columns[col].type);
+	}
+
+	// the rows are converted column by column into chunks, the Appender casts them to the table types
+	DataChunk chunk;
+	chunk.Initialize(duckdb::Allocator::DefaultAllocator(), types);
+	for (idx_t offset = 0; offset < group.rows.size(); offset += STANDARD_VECTOR_SIZE) {
+		auto count = duckdb::MinValue<idx_t>(STANDARD_VECTOR_SIZE, group.rows.size() - offset);
+		chunk.Reset();
+		for (idx_t i = 0; i < active_columns.size(); i++) {
+			ReadColumn(columns[active_columns[i]], chunk.data[i], group.rows.data() + offset, count);
+		}
+		chunk.SetCardinality(count);
+		appender.AppendDataChunk(chunk);
+	}
+	appender.Close();
+}
+
+SQLRETURN duckdb::BulkAddStmt(OdbcHandleStmt *hstmt) {
+	auto dbc = hstmt->dbc;
+	// the rows are inserted by another query, which would invalidate a pending asynchronous execution
+	if (hstmt->pending) {
+		return duckdb::SetDiagnosticRecord(hstmt, SQL_ERROR, "SQLBulkOperations",
+		                                   "The asynchronous execution is still in progress", SQLStateType::ST_HY010,
+		                                   dbc->GetDataSourceName());
+	}
+	SQLRETURN async_ret = CheckNoAsyncExecution(hstmt, "SQLBulkOperations");
+	if (async_ret != SQL_SUCCESS) {
+		return async_ret;
+	}
+	BulkAddTarget target;
+	if (!hstmt->stmt || !GetBulkAddTarget(hstmt, target)) {
+		return duckdb::SetDiagnosticRecord(hstmt, SQL_ERROR, "SQLBulkOperations",
+		                                   "SQL_ADD requires a cursor over the columns of a single table",
+		                                   SQLStateType::ST_HY000, dbc->GetDataSourceName());
+	}
+
+	auto ard = hstmt->row_desc->ard.get();
+	auto bind_offset = ard->header.sql_desc_bind_offset_ptr ? *ard->header.sql_desc_bind_offset_ptr : 0;
+	vector<BulkAddColumn> columns;
+	auto col_count = MinValue<idx_t>(hstmt->bound_cols.size(), target.column_names.size());
+	for (idx_t col_idx = 0; col_idx < col_count; col_idx++) {
+		auto &bound_col = hstmt->bound_cols[col_idx];
+		if (!bound_col.IsBound()) {
+			continue;
+		}
+		LogicalType type;
+		idx_t value_size;
+		if (!GetBulkAddType(bound_col, type, value_size)) {
+			return duckdb::SetDiagnosticRecord(hstmt, SQL_ERROR, "SQLBulkOperations",
+			                                   "Unsupported C type bound to column " + std::to_string(col_idx + 1),
+			                                   SQLStateType::ST_HY003, dbc->GetDataSourceName());
+		}
+		columns.emplace_back(bound_col, col_idx, std::move(type), value_size);
+		auto &column = columns.back();
+		if (ard->header.sql_desc_bind_type != SQL_BIND_BY_COLUMN) {
+			column.value_stride = ard->header.sql_desc_bind_type;
+			column.ind_stride = ard->header.sql_desc_bind_type;
+		}
+		column.bind_offset = bind_offset;
+	}
+	if (columns.empty()) {
+		return duckdb::SetDiagnosticRecord(hstmt, SQL_ERROR, "SQLBulkOperations", "No columns are bound",
+		                                   SQLStateType::ST_HY010, dbc->GetDataSourceName());
+	}
+
+	// the rows are inserted by another query, which would close a streaming result of this connection
+	auto ret = dbc->FlushInsertBatch(hstmt);
+	if (ret != SQL_SUCCESS) {
+		return ret;
+	}
+	ret = dbc->SpillStreamingResults(hstmt);
+	if (ret != SQL_SUCCESS) {
+		return ret;
+	}
+
+	idx_t row_count = ard->header.sql_desc_array_size;
+	auto row_status = hstmt->row_desc->ird->header.sql_desc_array_status_ptr;
+	// SQL_COLUMN_IGNORE is set per row, rows ignoring different columns are inserted separately
+	vector<BulkAddRowGroup> groups;
+	for (idx_t row = 0; row < row_count; row++) {
+		vector<bool> ignored;
+		for (auto &column : columns) {
+			ignored.push_back(column.IsIgnored(row));
+		}
+		auto group = std::find_if(groups.begin(), groups.end(),
+		                          [&](const BulkAddRowGroup &candidate) { return candidate.ignored == ignored; });
+		if (group == groups.end()) {
+			groups.push_back(BulkAddRowGroup {std::move(ignored), vector<idx_t>()});
+			group = groups.end() - 1;
+		}
+		group->rows.push_back(row);
+	}
+
+	// the rowset is added as a whole, also when it takes more than one insertion
+	bool own_transaction = groups.size() > 1 && dbc->conn->IsAutoCommit();
+	try {
+		if (own_transaction) {
+			dbc->conn->BeginTransaction();
+		}
+		for (auto &group : groups) {
+			AppendRowGroup(*dbc->conn, target, columns, group);
+		}
+		if (own_transaction) {
+			dbc->conn->Commit();
+		}
+	} catch (std::exception &ex) {
+		if (own_transaction && dbc->conn->HasActiveTransaction()) {
+			dbc->conn->Rollback();
+		}
+		if (row_status) {
+			for (idx_t row = 0; row < row_count; row++) {
+				row_status[row] = SQL_ROW_ERROR;
+			}
+		}
+		duckdb::ErrorData parsed_error(ex);
+		return duckdb::SetDiagnosticRecord(hstmt, SQL_ERROR, "SQLBulkOperations", parsed_error.RawMessage(),
+		                                   SQLStateType::ST_HY000, dbc->GetDataSourceName());
+	}
+
+	if (row_status) {
+		for (idx_t row = 0; row < row_count; row++) {
+			row_status[row] = SQL_ROW_ADDED;
+		}
+	}
+	return SQL_SUCCESS;
+}
@@ -0,0 +1,1197 @@
+#include "catalog_scan.hpp"
+
+#include "handle_functions.hpp"
+#include "metadata_cache.hpp"
+
+#include "duckdb/catalog/catalog.hpp"
+#include "duckdb/catalog/catalog_entry/index_catalog_entry.hpp"
+#include "duckdb/catalog/catalog_entry/schema_catalog_entry.hpp"
+#include "duckdb/catalog/catalog_entry/table_catalog_entry.hpp"
+#include "duckdb/catalog/catalog_entry/view_catalog_entry.hpp"
+#include "duckdb/common/string_util.hpp"
+#include "duckdb/common/types/column/column_data_collection.hpp"
+#include "duckdb/main/attached_database.hpp"
+#include "duckdb/main/database_manager.hpp"
+#include "duckdb/parallel/task_executor.hpp"
+#include "duckdb/parallel/task_scheduler.hpp"
+#include "duckdb/parser/constraints/foreign_key_constraint.hpp"
+#include "duckdb/parser/constraints/not_null_constraint.hpp"
+#include "duckdb/parser/constraints/unique_constraint.hpp"
+#include "duckdb/parser/expression/columnref_expression.hpp"
+#include "duckdb/storage/data_table.hpp"
+#include "duckdb/storage/table/scan_state.hpp"
+#include "duckdb/storage/table_storage_info.hpp"
+#include "duckdb/transaction/duck_transaction.hpp"
+#include "duckdb/transaction/local_storage.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <tuple>
+#include <unordered_map>
+#include <unordered_set>
+
+using duckdb::CatalogNameFilter;
+using duckdb::LogicalType;
+using duckdb::StringUtil;
+using duckdb::TableTypeFilter;
+using duckdb::Value;
+
+//! The escape character of the search patterns, see SQL_SEARCH_PATTERN_ESCAPE
+static constexpr char PATTERN_ESCAPE = '\\';
+
+//! Returns true when the name matches the search pattern, '%' matches any sequence and '_' any single character
+static bool LikeMatch(const char *name, duckdb::idx_t name_len, const char *pattern, duckdb::idx_t pattern_len) {
+	duckdb::idx_t pattern_idx = 0;
+	duckdb::idx_t name_idx = 0;
+	for (; pattern_idx < pattern_len && name_idx < name_len; pattern_idx++) {
+		char pattern_char = pattern[pattern_idx];
+		if (pattern_char == PATTERN_ESCAPE && pattern_idx + 1 < pattern_len) {
+			pattern_idx++;
+			if (pattern[pattern_idx] != name[name_idx]) {
+				return false;
+			}
+			name_idx++;
+		} else if (pattern_char == '_') {
+			// skips a whole UTF-8 character
+			name_idx++;
+			while (name_idx < name_len && (name[name_idx] & 0xC0) == 0x80) {
+				name_idx++;
+			}
+		} else if (pattern_char == '%') {
+			while (pattern_idx < pattern_len && pattern[pattern_idx] == '%') {
+				pattern_idx++;
+			}
+			if (pattern_idx == pattern_len) {
+				return true;
+			}
+			for (; name_idx < name_len; name_idx++) {
+				if (LikeMatch(name + name_idx, name_len - name_idx, pattern + pattern_idx, pattern_len - pattern_idx)) {
+					return true;
+				}
+			}
+			return false;
+		} else if (pattern_char == name[name_idx]) {
+			name_idx++;
+		} else {
+			return false;
+		}
+	}
+	while (pattern_idx < pattern_len && pattern[pattern_idx] == '%') {
+		pattern_idx++;
+	}
+	return pattern_idx == pattern_len && name_idx == name_len;
+}
+
+//===--------------------------------------------------------------------===//
+// CatalogNameFilter
+//===--------------------------------------------------------------------===//
+
+CatalogNameFilter::CatalogNameFilter() : type(FilterType::ANY) {
+}
+
+CatalogNameFilter::CatalogNameFilter(FilterType type, string name) : type(type), name(std::move(name)) {
+}
+
+CatalogNameFilter CatalogNameFilter::Pattern(const string &pattern) {
+	if (pattern.empty() || pattern == "%") {
+		return CatalogNameFilter();
+	}
+	// a pattern without wildcards names a single entry, which is looked up instead of scanned
+	string unescaped;
+	for (idx_t i = 0; i < pattern.size(); i++) {
+		if (pattern[i] == PATTERN_ESCAPE && i + 1 < pattern.size()) {
+			unescaped += pattern[++i];
+		} else if (pattern[i] == '%' || pattern[i] == '_') {
+			return CatalogNameFilter(FilterType::LIKE, pattern);
+		} else {
+			unescaped += pattern[i];
+		}
+	}
+	return Exact(unescaped);
+}
+
+CatalogNameFilter CatalogNameFilter::Identifier(const string &identifier) {
+	auto trimmed = identifier;
+	StringUtil::Trim(trimmed);
+	if (trimmed.empty()) {
+		return CatalogNameFilter();
+	}
+	// a quoted identifier is case sensitive, an unquoted one is compared like DuckDB compares identifiers
+	if (trimmed.size() >= 2 && trimmed.front() == '"' && trimmed.back() == '"') {
+		return Exact(StringUtil::Replace(trimmed.substr(1, trimmed.size() - 2), "\"\"", "\""));
+	}
+	return CatalogNameFilter(FilterType::CASE_INSENSITIVE, trimmed);
+}
+
+CatalogNameFilter CatalogNameFilter::Exact(const string &name) {
+	return CatalogNameFilter(FilterType::EXACT, name);
+}
+
+CatalogNameFilter CatalogNameFilter::Nothing() {
+	return CatalogNameFilter(FilterType::NOTHING, string());
+}
+
+CatalogNameFilter CatalogNameFilter::FromArgument(const string &argument, SQLUINTEGER metadata_id) {
+	if (metadata_id == SQL_TRUE) {
+		return Identifier(argument);
+	}
+	return Pattern(argument);
+}
+
+CatalogNameFilter CatalogNameFilter::FromOrdinaryArgument(const string &argument, SQLUINTEGER metadata_id) {
+	if (metadata_id == SQL_TRUE) {
+		return Identifier(argument);
+	}
+	return argument.empty() ? CatalogNameFilter() : Exact(argument);
+}
+
+const std::string CatalogNameFilter::EXCLUDE_CATALOGS_OPTION = "metadata_exclude_catalogs";
+
+duckdb::vector<std::string> CatalogNameFilter::ParseCatalogList(const string &catalogs) {
+	vector<string> result;
+	string current;
+	bool quoted = false;
+	auto add_name = [&]() {
+		StringUtil::Trim(current);
+		if (current.size() >= 2 && current.front() == '"' && current.back() == '"') {
+			current = StringUtil::Replace(current.substr(1, current.size() - 2), "\"\"", "\"");
+		}
+		if (!current.empty()) {
+			result.push_back(std::move(current));
+		}
+		current.clear();
+	};
+	for (auto c : catalogs) {
+		if (c == '"') {
+			quoted = !quoted;
+		} else if (c == ',' && !quoted) {
+			add_name();
+			continue;
+		}
+		current += c;
+	}
+	add_name();
+	return result;
+}
+
+CatalogNameFilter CatalogNameFilter::Excluding(const vector<string> &catalogs) const {
+	auto result = *this;
+	result.excluded.insert(result.excluded.end(), catalogs.begin(), catalogs.end());
+	// part of the cache key, the order the names were given in does not matter
+	std::sort(result.excluded.begin(), result.excluded.end(),
+	          [](const string &left, const string &right) { return StringUtil::CILessThan(left, right); });
+	return result;
+}
+
+bool CatalogNameFilter::Matches(const string &entry_name) const {
+	for (auto &excluded_name : excluded) {
+		if (StringUtil::CIEquals(entry_name, excluded_name)) {
+			return false;
+		}
+	}
+	switch (type) {
+	case FilterType::ANY:
+		return true;
+	case FilterType::NOTHING:
+		return false;
+	case FilterType::EXACT:
+		return entry_name == name;
+	case FilterType::CASE_INSENSITIVE:
+		return StringUtil::CIEquals(entry_name, name);
+	case FilterType::LIKE:
+		return LikeMatch(entry_name.c_str(), entry_name.size(), name.c_str(), name.size());
+	default:
+		return false;
+	}
+}
+
+bool CatalogNameFilter::IsSingleName() const {
+	return type == FilterType::EXACT || type == FilterType::CASE_INSENSITIVE;
+}
+
+std::string CatalogNameFilter::ToString() const {
+	auto result = std::to_string(static_cast<int>(type)) + ":" + std::to_string(name.size()) + ":" + name;
+	for (auto &excluded_name : excluded) {
+		result += "!" + std::to_string(excluded_name.size()) + ":" + StringUtil::Lower(excluded_name);
+	}
+	return result;
+}
+
+//===--------------------------------------------------------------------===//
+// TableTypeFilter
+//===--------------------------------------------------------------------===//
+
+TableTypeFilter::TableTypeFilter(const string &table_types_p) : all(table_types_p.empty()) {
+	idx_t start = 0;
+	while (start <= table_types_p.size()) {
+		auto end = table_types_p.find(',', start);
+		if (end == string::npos) {
+			end = table_types_p.size();
+		}
+		auto table_type = table_types_p.substr(start, end - start);
+		start = end + 1;
+
+		StringUtil::Trim(table_type);
+		if (table_type.size() >= 2 && table_type.front() == '\'' && table_type.back() == '\'') {
+			table_type = table_type.substr(1, table_type.size() - 2);
+		}
+		table_type = StringUtil::Upper(table_type);
+		if (table_type.empty() || table_type == "SYSTEM TABLE") {
+			// DuckDB has no system tables, the .Net provider asks for them
+			continue;
+		}
+		if (table_type == "%") {
+			all = true;
+		} else if (table_type == "TABLE") {
+			table_types.emplace_back("BASE TABLE");
+		} else {
+			table_types.push_back(table_type);
+		}
+	}
+}
+
+bool TableTypeFilter::Matches(const string &table_type) const {
+	return all || std::find(table_types.begin(), table_types.end(), table_type) != table_types.end();
+}
+
+std::string TableTypeFilter::ToString() const {
+	if (all) {
+		return "%";
+	}
+	return StringUtil::Join(table_types, ",");
+}
+
+//===--------------------------------------------------------------------===//
+// Catalog walk
+//===--------------------------------------------------------------------===//
+
+//! The visible catalogs that match the filter. Their transactions are started, so that the catalogs can be walked
+//! from other threads.
+static duckdb::vector<duckdb::reference<duckdb::Catalog>> GetScannedCatalogs(duckdb::ClientContext &context,
+                                                                             const CatalogNameFilter &catalog_filter) {
+	duckdb::vector<duckdb::reference<duckdb::Catalog>> catalogs;
+	for (auto &database : duckdb::DatabaseManager::Get(context).GetDatabases(context)) {
+		if (database->GetVisibility() == duckdb::AttachVisibility::HIDDEN) {
+			continue;
+		}
+		auto &catalog = database->GetCatalog();
+		if (!catalog_filter.Matches(catalog.GetName())) {
+			continue;
+		}
+		duckdb::Transaction::Get(context, catalog);
+		catalogs.push_back(catalog);
+	}
+	return catalogs;
+}
+
+//! Calls the callback for the tables and views of the catalog that match the filters
+static void ScanCatalogRelations(duckdb::ClientContext &context, duckdb::Catalog &catalog,
+                                 const CatalogNameFilter &schema_filter, const CatalogNameFilter &table_filter,
+                                 const std::function<void(duckdb::StandardEntry &)> &callback) {
+	duckdb::vector<duckdb::reference<duckdb::SchemaCatalogEntry>> schemas;
+	if (schema_filter.IsSingleName()) {
+		auto schema = catalog.GetSchema(context, schema_filter.GetName(), duckdb::OnEntryNotFound::RETURN_NULL);
+		if (schema) {
+			schemas.push_back(*schema);
+		}
+	} else {
+		schemas = catalog.GetSchemas(context);
+	}
+
+	for (auto &schema_ref : schemas) {
+		auto &schema = schema_ref.get();
+		if (!schema_filter.Matches(schema.name)) {
+			continue;
+		}
+		auto visit = [&](duckdb::CatalogEntry &entry) {
+			if (entry.internal || !table_filter.Matches(entry.name)) {
+				return;
+			}
+			if (entry.type == duckdb::CatalogType::TABLE_ENTRY || entry.type == duckdb::CatalogType::VIEW_ENTRY) {
+				callback(entry.Cast<duckdb::StandardEntry>());
+			}
+		};
+		if (table_filter.IsSingleName()) {
+			auto entry = schema.GetEntry(catalog.GetCatalogTransaction(context), duckdb::CatalogType::TABLE_ENTRY,
+			                             table_filter.GetName());
+			if (entry) {
+				visit(*entry);
+			}
+		} else {
+			schema.Scan(context, duckdb::CatalogType::TABLE_ENTRY, visit);
+		}
+	}
+}
+
+//! Calls the callback for the tables and views of the visible catalogs that match the filters
+static void ScanRelations(duckdb::ClientContext &context, const CatalogNameFilter &catalog_filter,
+                          const CatalogNameFilter &schema_filter, const CatalogNameFilter &table_filter,
+                          const std::function<void(duckdb::StandardEntry &)> &callback) {
+	for (auto &catalog : GetScannedCatalogs(context, catalog_filter)) {
+		ScanCatalogRelations(context, catalog.get(), schema_filter, table_filter, callback);
+	}
+}
+
+namespace {
+//! Walks one catalog, see ScanCatalogsInParallel
+class CatalogScanTask : public duckdb::BaseExecutorTask {
+public:
+	CatalogScanTask(duckdb::TaskExecutor &executor, const std::function<void(duckdb::idx_t)> &scan,
+	                duckdb::idx_t catalog_idx)
+	    : BaseExecutorTask(executor), scan(scan), catalog_idx(catalog_idx) {
+	}
+
+	void ExecuteTask() override {
+		scan(catalog_idx);
+	}
+
+	std::string TaskType() const override {
+		return "CatalogScanTask";
+	}
+
+private:
+	const std::function<void(duckdb::idx_t)> &scan;
+	duckdb::idx_t catalog_idx;
+};
+} // namespace
+
+//! Calls the scan for every catalog index, the catalogs are walked concurrently on the task scheduler of the database.
+//! Attached catalogs can need I/O to be enumerated, e.g., DuckLake or remote catalogs.
+static void ScanCatalogsInParallel(duckdb::ClientContext &context, duckdb::idx_t catalog_count,
+                                   const std::function<void(duckdb::idx_t)> &scan) {
+	auto &scheduler = duckdb::TaskScheduler::GetScheduler(context);
+	if (catalog_count <= 1 || scheduler.NumberOfThreads() <= 1) {
+		for (duckdb::idx_t catalog_idx = 0; catalog_idx < catalog_count; catalog_idx++) {
+			scan(catalog_idx);
+		}
+		return;
+	}
+	duckdb::TaskExecutor executor(context);
+	for (duckdb::idx_t catalog_idx = 0; catalog_idx < catalog_count; catalog_idx++) {
+		executor.ScheduleTask(duckdb::make_uniq<CatalogScanTask>(executor, scan, catalog_idx));
+	}
+	// the calling thread works on the tasks as well, an error of a task is thrown here
+	executor.WorkOnTasks();
+}
+
+//! Appends the result rows to a collection one value at a time
+class MetadataRowWriter {
+public:
+	MetadataRowWriter(duckdb::ClientContext &context, const duckdb::vector<LogicalType> &types)
+	    : collection(duckdb::make_uniq<duckdb::ColumnDataCollection>(context, types)) {
+		collection->InitializeAppend(append_state);
+		chunk.Initialize(context, types);
+	}
+
+	void NextRow() {
+		if (row + 1 == STANDARD_VECTOR_SIZE) {
+			Flush();
+		}
+		row = chunk.size();
+		chunk.SetCardinality(row + 1);
+		col = 0;
+	}
+
+	void Write(Value value) {
+		chunk.SetValue(col++, row, value);
+	}
+
+	duckdb::unique_ptr<duckdb::ColumnDataCollection> Finish() {
+		Flush();
+		return std::move(collection);
+	}
+
+private:
+	void Flush() {
+		if (chunk.size() > 0) {
+			collection->Append(append_state, chunk);
+			chunk.Reset();
+		}
+		row = 0;
+	}
+
+	duckdb::unique_ptr<duckdb::ColumnDataCollection> collection;
+	duckdb::ColumnDataAppendState append_state;
+	duckdb::DataChunk chunk;
+	duckdb::idx_t row = 0;
+	duckdb::idx_t col = 0;
+};
+
+//===--------------------------------------------------------------------===//
+// SQLTables
+//===--------------------------------------------------------------------===//
+
+//! The ducklake extension keeps its metadata in catalogs attached under this prefix
+static bool IsDucklakeMetadataCatalog(const std::string &catalog_name) {
+	static const auto ducklake_filter = CatalogNameFilter::Pattern("__ducklake_%");
+	return ducklake_filter.Matches(catalog_name);
+}
+
+namespace {
+struct TableRow {
+	std::string catalog;
+	std::string schema;
+	std::string name;
+	//! TABLE_TYPE of the result, 'TABLE', 'LOCAL TEMPORARY' or 'VIEW'
+	std::string table_type;
+};
+} // namespace
+
+SQLRETURN duckdb::CatalogTablesStmt(OdbcHandleStmt *hstmt, const CatalogNameFilter &catalog_filter_p,
+                                    const CatalogNameFilter &schema_filter, const CatalogNameFilter &table_filter,
+                                    const TableTypeFilter &table_type_filter) {
+	static const vector<string> names {"TABLE_CAT", "TABLE_SCHEM", "TABLE_NAME", "TABLE_TYPE", "REMARKS"};
+	static const vector<LogicalType> types(names.size(), LogicalType::VARCHAR);
+
+	auto catalog_filter = catalog_filter_p.Excluding(hstmt->dbc->metadata_excluded_catalogs);
+	auto key = "SQLTables:" + catalog_filter.ToString() + schema_filter.ToString() + table_filter.ToString() +
+	           table_type_filter.ToString();
+	return ExecMetadataStmt(hstmt, "SQLTables", key, names, types, [&](ClientContext &context) {
+		auto catalogs = GetScannedCatalogs(context, catalog_filter);
+		// each catalog has its own rows, they are merged once all the catalogs were walked
+		vector<std::vector<TableRow>> catalog_rows(catalogs.size());
+		ScanCatalogsInParallel(context, catalogs.size(), [&](idx_t catalog_idx) {
+			auto &catalog = catalogs[catalog_idx].get();
+			auto &catalog_name = catalog.GetName();
+			if (IsDucklakeMetadataCatalog(catalog_name)) {
+				return;
+			}
+			auto &rows = catalog_rows[catalog_idx];
+			ScanCatalogRelations(context, catalog, schema_filter, table_filter, [&](StandardEntry &entry) {
+				string table_type = "VIEW";
+				if (entry.type == CatalogType::TABLE_ENTRY) {
+					table_type = entry.temporary ? "LOCAL TEMPORARY" : "BASE TABLE";
+				}
+				if (!table_type_filter.Matches(table_type)) {
+					return;
+				}
+				rows.push_back({catalog_name, entry.ParentSchema().name, entry.name,
+				                table_type == "BASE TABLE" ? "TABLE" : table_type});
+			});
+		});
+		std::vector<TableRow> rows;
+		for (auto &catalog_row : catalog_rows) {
+			rows.insert(rows.end(), std::make_move_iterator(catalog_row.begin()),
+			            std::make_move_iterator(catalog_row.end()));
+		}
+		std::sort(rows.begin(), rows.end(), [](const TableRow &left, const TableRow &right) {
+			return std::tie(left.table_type, left.catalog, left.schema, left.name) <
+			       std::tie(right.table_type, right.catalog, right.schema, right.name);
+		});
+
+		MetadataRowWriter writer(context, types);
+		for (auto &table : rows) {
+			writer.NextRow();
+			writer.Write(Value(table.catalog));
+			writer.Write(Value(table.schema));
+			writer.Write(Value(table.name));
+			writer.Write(Value(table.table_type));
+			writer.Write(Value(""));
+		}
+		return writer.Finish();
+	});
+}
+
+SQLRETURN duckdb::CatalogListStmt(OdbcHandleStmt *hstmt, CatalogListType list_type) {
+	static const vector<string> names {"TABLE_CAT", "TABLE_SCHEM", "TABLE_NAME", "TABLE_TYPE", "REMARKS"};
+	static const vector<LogicalType> types(names.size(), LogicalType::VARCHAR);
+
+	auto catalog_filter = CatalogNameFilter().Excluding(hstmt->dbc->metadata_excluded_catalogs);
+	auto key = "SQLTables:list:" + std::to_string(static_cast<uint8_t>(list_type)) + catalog_filter.ToString();
+	return ExecMetadataStmt(hstmt, "SQLTables", key, names, types, [&](ClientContext &context) {
+		vector<string> values;
+		idx_t column;
+		if (list_type == CatalogListType::TABLE_TYPES) {
+			values = {"TABLE", "VIEW"};
+			column = 3;
+		} else {
+			for (auto &catalog_ref : GetScannedCatalogs(context, catalog_filter)) {
+				auto &catalog = catalog_ref.get();
+				auto &catalog_name = catalog.GetName();
+				if (catalog_name == SYSTEM_CATALOG || catalog_name == TEMP_CATALOG ||
+				    IsDucklakeMetadataCatalog(catalog_name)) {
+					continue;
+				}
+				if (list_type == CatalogListType::CATALOGS) {
+					values.push_back(catalog_name);
+					continue;
+				}
+				for (auto &schema : catalog.GetSchemas(context)) {
+					values.push_back(schema.get().name);
+				}
+			}
+			column = list_type == CatalogListType::CATALOGS ? 0 : 1;
+			std::sort(values.begin(), values.end());
+		}
+
+		MetadataRowWriter writer(context, types);
+		for (auto &value : values) {
+			writer.NextRow();
+			for (idx_t i = 0; i < names.size(); i++) {
+				writer.Write(i == column ? Value(value) : Value(LogicalType::VARCHAR));
+			}
+		}
+		return writer.Finish();
+	});
+}
+
+//===--------------------------------------------------------------------===//
+// SQLColumns
+//===--------------------------------------------------------------------===//
+
+namespace {
+//! A column of a table or view, see duckdb_columns
+struct ColumnInfo {
+	std::string name;
+	LogicalType type;
+	Value column_default;
+	bool is_nullable;
+};
+} // namespace
+
+static duckdb::vector<ColumnInfo> GetEntryColumns(duckdb::StandardEntry &entry) {
+	duckdb::vector<ColumnInfo> columns;
+	if (entry.type == duckdb::CatalogType::VIEW_ENTRY) {
+		auto &view = entry.Cast<duckdb::ViewCatalogEntry>();
+		for (duckdb::idx_t i = 0; i < view.types.size(); i++) {
+			auto &name = i < view.aliases.size() ? view.aliases[i] : view.names[i];
+			columns.push_back({name, view.types[i], Value(), true});
+		}
+		return columns;
+	}
+	auto &table = entry.Cast<duckdb::TableCatalogEntry>();
+	std::unordered_set<duckdb::idx_t> not_null_columns;
+	for (auto &constraint : table.GetConstraints()) {
+		if (constraint->type == duckdb::ConstraintType::NOT_NULL) {
+			not_null_columns.insert(constraint->Cast<duckdb::NotNullConstraint>().index.index);
+		}
+	}
+	for (auto &column : table.GetColumns().Logical()) {
+		Value column_default;
+		if (column.Generated()) {
+			column_default = Value(column.GeneratedExpression().ToString());
+		} else if (column.HasDefaultValue()) {
+			column_default = Value(column.DefaultValue().ToString());
+		}
+		bool is_nullable = not_null_columns.find(column.Logical().index) == not_null_columns.end();
+		columns.push_back({column.Name(), column.Type(), std::move(column_default), is_nullable});
+	}
+	return columns;
+}
+
+//! Numeric precision, radix and scale of a column, as reported by duckdb_columns
+static void GetNumericPrecision(const LogicalType &type, Value &precision, Value &radix, Value &scale) {
+	int32_t binary_precision;
+	switch (type.id()) {
+	case duckdb::LogicalTypeId::DECIMAL:
+		precision = Value::INTEGER(duckdb::DecimalType::GetWidth(type));
+		radix = Value::INTEGER(10);
+		scale = Value::INTEGER(duckdb::DecimalType::GetScale(type));
+		return;
+	case duckdb::LogicalTypeId::HUGEINT:
+		binary_precision = 128;
+		break;
+	case duckdb::LogicalTypeId::BIGINT:
+		binary_precision = 64;
+		break;
+	case duckdb::LogicalTypeId::INTEGER:
+		binary_precision = 32;
+		break;
+	case duckdb::LogicalTypeId::SMALLINT:
+		binary_precision = 16;
+		break;
+	case duckdb::LogicalTypeId::TINYINT:
+		binary_precision = 8;
+		break;
+	case duckdb::LogicalTypeId::FLOAT:
+		binary_precision = 24;
+		break;
+	case duckdb::LogicalTypeId::DOUBLE:
+		binary_precision = 53;
+		break;
+	default:
+		precision = Value(LogicalType::INTEGER);
+		radix = Value(LogicalType::INTEGER);
+		scale = Value(LogicalType::INTEGER);
+		return;
+	}
+	precision = Value::INTEGER(binary_precision);
+	radix = Value::INTEGER(2);
+	scale = Value::INTEGER(0);
+}
+
+//! Writes the SQLColumns row of a column, the ODBC attributes are derived from the DuckDB type name
+static void WriteColumnRow(MetadataRowWriter &writer, duckdb::StandardEntry &entry, const ColumnInfo &column,
+                           int32_t ordinal_position) {
+	static const std::unordered_map<std::string, int16_t> sql_types {
+	    {"BOOLEAN", SQL_CHAR},     {"TINYINT", SQL_TINYINT},       {"UTINYINT", SQL_TINYINT},
+	    {"SMALLINT", SQL_SMALLINT}, {"USMALLINT", SQL_SMALLINT},   {"INTEGER", SQL_INTEGER},
+	    {"UINTEGER", SQL_INTEGER}, {"BIGINT", SQL_BIGINT},         {"UBIGINT", SQL_BIGINT},
+	    {"HUGEINT", SQL_NUMERIC},  {"UHUGEINT", SQL_NUMERIC},      {"FLOAT", SQL_FLOAT},
+	    {"DOUBLE", SQL_DOUBLE},    {"DATE", SQL_TYPE_DATE},        {"TIME", SQL_TYPE_TIME},
+	    {"VARCHAR", SQL_VARCHAR},  {"BLOB", SQL_VARBINARY},        {"INTERVAL", SQL_INTERVAL},
+	    {"DECIMAL", SQL_NUMERIC},  {"BIT", SQL_BIT},               {"LIST", SQL_VARCHAR}};
+
+	auto data_type = column.type.ToString();
+	auto type_name = data_type.substr(0, data_type.find('('));
+	bool is_timestamp = StringUtil::StartsWith(data_type, "TIMESTAMP");
+
+	Value precision, radix, scale;
+	GetNumericPrecision(column.type, precision, radix, scale);
+
+	int16_t sql_type;
+	auto sql_type_entry = sql_types.find(type_name);
+	if (is_timestamp) {
+		sql_type = SQL_TYPE_TIMESTAMP;
+	} else if (sql_type_entry != sql_types.end()) {
+		sql_type = sql_type_entry->second;
+	} else {
+		sql_type = static_cast<int16_t>(column.type.id());
+	}
+
+	Value column_size(LogicalType::INTEGER);
+	if (data_type == "DATE") {
+		column_size = Value::INTEGER(12);
+	} else if (data_type == "TIME") {
+		column_size = Value::INTEGER(15);
+	} else if (is_timestamp) {
+		column_size = Value::INTEGER(26);
+	} else if (data_type == "CHAR" || data_type == "BOOLEAN") {
+		column_size = Value::INTEGER(1);
+	} else if (data_type == "VARCHAR" || data_type == "BLOB") {
+		// DuckDB strings have no maximum length
+	} else if (StringUtil::Contains(data_type, "INT") || StringUtil::StartsWith(data_type, "DECIMAL") ||
+	           data_type == "FLOAT" || data_type == "DOUBLE") {
+		column_size = precision;
+	}
+
+	Value buffer_length(LogicalType::INTEGER);
+	if (data_type == "DATE") {
+		buffer_length = Value::INTEGER(4);
+	} else if (StringUtil::StartsWith(data_type, "TIME")) {
+		buffer_length = Value::INTEGER(8);
+	} else if (data_type == "CHAR" || data_type == "BOOLEAN") {
+		buffer_length = Value::INTEGER(1);
+	} else if (data_type == "VARCHAR" || data_type == "BLOB") {
+		buffer_length = Value::INTEGER(16);
+	} else if (StringUtil::EndsWith(data_type, "TINYINT")) {
+		buffer_length = Value::INTEGER(1);
+	} else if (StringUtil::EndsWith(data_type, "SMALLINT")) {
+		buffer_length = Value::INTEGER(2);
+	} else if (StringUtil::EndsWith(data_type, "INTEGER")) {
+		buffer_length = Value::INTEGER(4);
+	} else if (StringUtil::EndsWith(data_type, "BIGINT")) {
+		buffer_length = Value::INTEGER(8);
+	} else if (data_type == "HUGEINT" || StringUtil::StartsWith(data_type, "DECIMAL")) {
+		buffer_length = Value::INTEGER(16);
+	} else if (data_type == "FLOAT") {
+		buffer_length = Value::INTEGER(4);
+	} else if (data_type == "DOUBLE") {
+		buffer_length = Value::INTEGER(8);
+	}
+
+	Value datetime_sub(LogicalType::SMALLINT);
+	if (data_type == "DATE") {
+		datetime_sub = Value::SMALLINT(SQL_CODE_DATE);
+	} else if (is_timestamp) {
+		datetime_sub = Value::SMALLINT(SQL_CODE_TIMESTAMP);
+	} else if (StringUtil::StartsWith(data_type, "TIME")) {
+		datetime_sub = Value::SMALLINT(SQL_CODE_TIME);
+	}
+
+	if (type_name == "DECIMAL") {
+		type_name = "NUMERIC";
+	} else if (is_timestamp) {
+		type_name = "TIMESTAMP";
+	}
+
+	writer.NextRow();
+	writer.Write(Value(LogicalType::VARCHAR));
+	writer.Write(Value(entry.ParentSchema().name));
+	writer.Write(Value(entry.name));
+	writer.Write(Value(column.name));
+	writer.Write(Value::SMALLINT(sql_type));
+	writer.Write(Value(type_name));
+	writer.Write(column_size);
+	writer.Write(buffer_length);
+	writer.Write(scale.DefaultCastAs(LogicalType::SMALLINT));
+	writer.Write(radix.DefaultCastAs(LogicalType::SMALLINT));
+	writer.Write(Value::SMALLINT(column.is_nullable ? SQL_NULLABLE : SQL_NO_NULLS));
+	writer.Write(Value(""));
+	writer.Write(column.column_default);
+	writer.Write(Value::SMALLINT(sql_type));
+	writer.Write(datetime_sub);
+	writer.Write(Value(LogicalType::INTEGER));
+	writer.Write(Value::INTEGER(ordinal_position));
+	writer.Write(Value(column.is_nullable ? "YES" : "NO"));
+}
+
+SQLRETURN duckdb::CatalogColumnsStmt(OdbcHandleStmt *hstmt, const CatalogNameFilter &catalog_filter_p,
+                                     const CatalogNameFilter &schema_filter, const CatalogNameFilter &table_filter,
+                                     const CatalogNameFilter &column_filter) {
+	static const vector<string> names {
+	    "TABLE_CAT",     "TABLE_SCHEM",      "TABLE_NAME",        "COLUMN_NAME",      "DATA_TYPE",
+	    "TYPE_NAME",     "COLUMN_SIZE",      "BUFFER_LENGTH",     "DECIMAL_DIGITS",   "NUM_PREC_RADIX",
+	    "NULLABLE",      "REMARKS",          "COLUMN_DEF",        "SQL_DATA_TYPE",    "SQL_DATETIME_SUB",
+	    "CHAR_OCTET_LENGTH", "ORDINAL_POSITION", "IS_NULLABLE"};
+	static const vector<LogicalType> types {
+	    LogicalType::VARCHAR,  LogicalType::VARCHAR,  LogicalType::VARCHAR,  LogicalType::VARCHAR,
+	    LogicalType::SMALLINT, LogicalType::VARCHAR,  LogicalType::INTEGER,  LogicalType::INTEGER,
+	    LogicalType::SMALLINT, LogicalType::SMALLINT, LogicalType::SMALLINT, LogicalType::VARCHAR,
+	    LogicalType::VARCHAR,  LogicalType::SMALLINT, LogicalType::SMALLINT, LogicalType::INTEGER,
+	    LogicalType::INTEGER,  LogicalType::VARCHAR};
+
+	auto catalog_filter = catalog_filter_p.Excluding(hstmt->dbc->metadata_excluded_catalogs);
+	auto key = "SQLColumns:" + catalog_filter.ToString() + schema_filter.ToString() + table_filter.ToString() +
+	           column_filter.ToString();
+	return ExecMetadataStmt(hstmt, "SQLColumns", key, names, types, [&](ClientContext &context) {
+		std::vector<reference<StandardEntry>> entries;
+		ScanRelations(context, catalog_filter, schema_filter, table_filter,
+		              [&](StandardEntry &entry) { entries.push_back(entry); });
+		// TABLE_CAT is always NULL, the rows are ordered by schema and table name
+		std::stable_sort(entries.begin(), entries.end(), [](StandardEntry &left, StandardEntry &right) {
+			return std::tie(left.ParentSchema().name, left.name) < std::tie(right.ParentSchema().name, right.name);
+		});
+
+		MetadataRowWriter writer(context, types);
+		for (auto &entry : entries) {
+			auto columns = GetEntryColumns(entry.get());
+			for (idx_t i = 0; i < columns.size(); i++) {
+				if (column_filter.Matches(columns[i].name)) {
+					WriteColumnRow(writer, entry.get(), columns[i], static_cast<int32_t>(i + 1));
+				}
+			}
+		}
+		return writer.Finish();
+	});
+}
+
+//===--------------------------------------------------------------------===//
+// SQLPrimaryKeys and SQLForeignKeys
+//===--------------------------------------------------------------------===//
+
+//! Calls the callback for the tables, but not the views, that match the filters
+static void ScanTables(duckdb::ClientContext &context, const CatalogNameFilter &catalog_filter,
+                       const CatalogNameFilter &schema_filter, const CatalogNameFilter &table_filter,
+                       const std::function<void(duckdb::TableCatalogEntry &)> &callback) {
+	ScanRelations(context, catalog_filter, schema_filter, table_filter, [&](duckdb::StandardEntry &entry) {
+		if (entry.type == duckdb::CatalogType::TABLE_ENTRY) {
+			callback(entry.Cast<duckdb::TableCatalogEntry>());
+		}
+	});
+}
+
+//! Looks up a table referenced by a constraint, the name is compared case insensitively
+static duckdb::optional_ptr<duckdb::TableCatalogEntry> LookupTable(duckdb::ClientContext &context,
+                                                                   duckdb::SchemaCatalogEntry &schema,
+                                                                   const std::string &name) {
+	auto entry = schema.GetEntry(schema.ParentCatalog().GetCatalogTransaction(context),
+	                             duckdb::CatalogType::TABLE_ENTRY, name);
+	if (!entry || entry->type != duckdb::CatalogType::TABLE_ENTRY) {
+		return nullptr;
+	}
+	return &entry->Cast<duckdb::TableCatalogEntry>();
+}
+
+//! Replaces the column names of a constraint, written as in its definition, with the names of the table columns
+static duckdb::vector<std::string> ResolveColumnNames(duckdb::TableCatalogEntry &table,
+                                                      const duckdb::vector<std::string> &names) {
+	duckdb::vector<std::string> result;
+	for (auto &name : names) {
+		result.push_back(table.ColumnExists(name) ? table.GetColumn(name).GetName() : name);
+	}
+	return result;
+}
+
+//! Column names of a PRIMARY KEY or UNIQUE constraint
+static duckdb::vector<std::string> GetUniqueColumns(duckdb::TableCatalogEntry &table,
+                                                    const duckdb::UniqueConstraint &unique) {
+	if (unique.HasIndex()) {
+		return {table.GetColumn(unique.GetIndex()).GetName()};
+	}
+	return ResolveColumnNames(table, unique.GetColumnNames());
+}
+
+//! Name of a constraint as reported by duckdb_constraints, the table and the lowercase column names with a suffix
+static std::string GetConstraintName(const std::string &table_name, const duckdb::vector<std::string> &columns,
+                                     const duckdb::vector<std::string> &referenced_columns, const char *suffix) {
+	auto result = table_name + "_";
+	for (auto &column : columns) {
+		result += StringUtil::Lower(column) + "_";
+	}
+	for (auto &column : referenced_columns) {
+		result += StringUtil::Lower(column) + "_";
+	}
+	return result + suffix;
+}
+
+//! Name of the PRIMARY KEY or UNIQUE constraint of the table on exactly these columns
+static Value GetUniqueConstraintName(duckdb::TableCatalogEntry &table, const duckdb::vector<std::string> &columns) {
+	for (auto &constraint : table.GetConstraints()) {
+		if (constraint->type != duckdb::ConstraintType::UNIQUE) {
+			continue;
+		}
+		auto &unique = constraint->Cast<duckdb::UniqueConstraint>();
+		auto unique_columns = GetUniqueColumns(table, unique);
+		if (unique_columns.size() == columns.size() &&
+		    std::equal(unique_columns.begin(), unique_columns.end(), columns.begin(),
+		               [](const std::string &left, const std::string &right) { return StringUtil::CIEquals(left, right); })) {
+			return Value(GetConstraintName(table.name, unique_columns, {}, unique.IsPrimaryKey() ? "pkey" : "key"));
+		}
+	}
+	return Value(LogicalType::VARCHAR);
+}
+
+SQLRETURN duckdb::CatalogPrimaryKeysStmt(OdbcHandleStmt *hstmt, const CatalogNameFilter &catalog_filter_p,
+                                         const CatalogNameFilter &schema_filter,
+                                         const CatalogNameFilter &table_filter) {
+	static const vector<string> names {"TABLE_CAT", "TABLE_SCHEM", "TABLE_NAME", "COLUMN_NAME", "KEY_SEQ", "PK_NAME"};
+	static const vector<LogicalType> types {LogicalType::VARCHAR, LogicalType::VARCHAR,  LogicalType::VARCHAR,
+	                                        LogicalType::VARCHAR, LogicalType::SMALLINT, LogicalType::VARCHAR};
+
+	auto catalog_filter = catalog_filter_p.Excluding(hstmt->dbc->metadata_excluded_catalogs);
+	auto key = "SQLPrimaryKeys:" + catalog_filter.ToString() + schema_filter.ToString() + table_filter.ToString();
+	return ExecMetadataStmt(hstmt, "SQLPrimaryKeys", key, names, types, [&](ClientContext &context) {
+		std::vector<reference<TableCatalogEntry>> tables;
+		ScanTables(context, catalog_filter, schema_filter, table_filter,
+		           [&](TableCatalogEntry &table) { tables.push_back(table); });
+		std::sort(tables.begin(), tables.end(), [](TableCatalogEntry &left, TableCatalogEntry &right) {
+			return std::tie(left.ParentCatalog().GetName(), left.ParentSchema().name, left.name) <
+			       std::tie(right.ParentCatalog().GetName(), right.ParentSchema().name, right.name);
+		});
+
+		MetadataRowWriter writer(context, types);
+		for (auto &table_ref : tables) {
+			auto &table = table_ref.get();
+			for (auto &constraint : table.GetConstraints()) {
+				if (constraint->type != ConstraintType::UNIQUE ||
+				    !constraint->Cast<UniqueConstraint>().IsPrimaryKey()) {
+					continue;
+				}
+				auto columns = GetUniqueColumns(table, constraint->Cast<UniqueConstraint>());
+				auto pk_name = GetConstraintName(table.name, columns, {}, "pkey");
+				for (idx_t i = 0; i < columns.size(); i++) {
+					writer.NextRow();
+					writer.Write(Value(table.ParentCatalog().GetName()));
+					writer.Write(Value(table.ParentSchema().name));
+					writer.Write(Value(table.name));
+					writer.Write(Value(columns[i]));
+					writer.Write(Value::SMALLINT(static_cast<int16_t>(i + 1)));
+					writer.Write(Value(pk_name));
+				}
+			}
+		}
+		return writer.Finish();
+	});
+}
+
+namespace {
+//! A foreign key, DuckDB only allows them between tables of the same schema
+struct ForeignKeyRow {
+	std::string catalog;
+	std::string schema;
+	std::string pk_table;
+	std::string fk_table;
+	duckdb::vector<std::string> pk_columns;
+	duckdb::vector<std::string> fk_columns;
+	std::string fk_name;
+	Value pk_name;
+};
+} // namespace
+
+SQLRETURN duckdb::CatalogForeignKeysStmt(OdbcHandleStmt *hstmt, const CatalogNameFilter &pk_catalog_filter_p,
+                                         const CatalogNameFilter &pk_schema_filter,
+                                         const CatalogNameFilter &pk_table_filter,
+                                         const CatalogNameFilter &fk_catalog_filter_p,
+                                         const CatalogNameFilter &fk_schema_filter,
+                                         const CatalogNameFilter &fk_table_filter, bool walk_fk_tables) {
+	static const vector<string> names {"PKTABLE_CAT",   "PKTABLE_SCHEM", "PKTABLE_NAME", "PKCOLUMN_NAME", "FKTABLE_CAT",
+	                                   "FKTABLE_SCHEM", "FKTABLE_NAME",  "FKCOLUMN_NAME", "KEY_SEQ",      "UPDATE_RULE",
+	                                   "DELETE_RULE",   "FK_NAME",       "PK_NAME",       "DEFERRABILITY"};
+	static const vector<LogicalType> types {
+	    LogicalType::VARCHAR,  LogicalType::VARCHAR,  LogicalType::VARCHAR,  LogicalType::VARCHAR,
+	    LogicalType::VARCHAR,  LogicalType::VARCHAR,  LogicalType::VARCHAR,  LogicalType::VARCHAR,
+	    LogicalType::SMALLINT, LogicalType::SMALLINT, LogicalType::SMALLINT, LogicalType::VARCHAR,
+	    LogicalType::VARCHAR,  LogicalType::SMALLINT};
+
+	auto pk_catalog_filter = pk_catalog_filter_p.Excluding(hstmt->dbc->metadata_excluded_catalogs);
+	auto fk_catalog_filter = fk_catalog_filter_p.Excluding(hstmt->dbc->metadata_excluded_catalogs);
+	auto key = "SQLForeignKeys:" + pk_catalog_filter.ToString() + pk_schema_filter.ToString() +
+	           pk_table_filter.ToString() + fk_catalog_filter.ToString() + fk_schema_filter.ToString() +
+	           fk_table_filter.ToString() + (walk_fk_tables ? "fk" : "pk");
+	return ExecMetadataStmt(hstmt, "SQLForeignKeys", key, names, types, [&](ClientContext &context) {
+		std::vector<ForeignKeyRow> foreign_keys;
+		auto add_foreign_key = [&](TableCatalogEntry &pk_table, TableCatalogEntry &fk_table,
+		                           const ForeignKeyConstraint &fk) {
+			auto &catalog_name = fk_table.ParentCatalog().GetName();
+			auto &schema_name = fk_table.ParentSchema().name;
+			if (!pk_catalog_filter.Matches(catalog_name) || !fk_catalog_filter.Matches(catalog_name) ||
+			    !pk_schema_filter.Matches(schema_name) || !fk_schema_filter.Matches(schema_name) ||
+			    !pk_table_filter.Matches(pk_table.name) || !fk_table_filter.Matches(fk_table.name)) {
+				return;
+			}
+			auto pk_columns = ResolveColumnNames(pk_table, fk.pk_columns);
+			auto fk_columns = ResolveColumnNames(fk_table, fk.fk_columns);
+			auto fk_name = GetConstraintName(fk_table.name, fk_columns, pk_columns, "fkey");
+			auto pk_name = GetUniqueConstraintName(pk_table, pk_columns);
+			foreign_keys.push_back({catalog_name, schema_name, pk_table.name, fk_table.name, std::move(pk_columns),
+			                        std::move(fk_columns), std::move(fk_name), std::move(pk_name)});
+		};
+
+		// both sides of a foreign key constraint record it, the side whose table is known is walked
+		auto &catalog_filter = walk_fk_tables ? fk_catalog_filter : pk_catalog_filter;
+		auto &schema_filter = walk_fk_tables ? fk_schema_filter : pk_schema_filter;
+		auto &table_filter = walk_fk_tables ? fk_table_filter : pk_table_filter;
+		auto walked_side =
+		    walk_fk_tables ? ForeignKeyType::FK_TYPE_FOREIGN_KEY_TABLE : ForeignKeyType::FK_TYPE_PRIMARY_KEY_TABLE;
+		ScanTables(context, catalog_filter, schema_filter, table_filter, [&](TableCatalogEntry &table) {
+			for (auto &constraint : table.GetConstraints()) {
+				if (constraint->type != ConstraintType::FOREIGN_KEY) {
+					continue;
+				}
+				auto &fk = constraint->Cast<ForeignKeyConstraint>();
+				if (fk.info.type == ForeignKeyType::FK_TYPE_SELF_REFERENCE_TABLE) {
+					add_foreign_key(table, table, fk);
+					continue;
+				}
+				if (fk.info.type != walked_side) {
+					continue;
+				}
+				auto other_table = LookupTable(context, table.ParentSchema(), fk.info.table);
+				if (!other_table) {
+					continue;
+				}
+				if (walk_fk_tables) {
+					add_foreign_key(*other_table, table, fk);
+				} else {
+					add_foreign_key(table, *other_table, fk);
+				}
+			}
+		});
+
+		// ordered by the table that was not given, then by KEY_SEQ
+		std::sort(foreign_keys.begin(), foreign_keys.end(),
+		          [&](const ForeignKeyRow &left, const ForeignKeyRow &right) {
+			          auto &left_table = walk_fk_tables ? left.pk_table : left.fk_table;
+			          auto &right_table = walk_fk_tables ? right.pk_table : right.fk_table;
+			          return std::tie(left.catalog, left.schema, left_table, left.fk_name) <
+			                 std::tie(right.catalog, right.schema, right_table, right.fk_name);
+		          });
+
+		MetadataRowWriter writer(context, types);
+		for (auto &foreign_key : foreign_keys) {
+			for (idx_t i = 0; i < foreign_key.fk_columns.size() && i < foreign_key.pk_columns.size(); i++) {
+				writer.NextRow();
+				writer.Write(Value(foreign_key.catalog));
+				writer.Write(Value(foreign_key.schema));
+				writer.Write(Value(foreign_key.pk_table));
+				writer.Write(Value(foreign_key.pk_columns[i]));
+				writer.Write(Value(foreign_key.catalog));
+				writer.Write(Value(foreign_key.schema));
+				writer.Write(Value(foreign_key.fk_table));
+				writer.Write(Value(foreign_key.fk_columns[i]));
+				writer.Write(Value::SMALLINT(static_cast<int16_t>(i + 1)));
+				// DuckDB does not support referential actions
+				writer.Write(Value::SMALLINT(SQL_NO_ACTION));
+				writer.Write(Value::SMALLINT(SQL_NO_ACTION));
+				writer.Write(Value(foreign_key.fk_name));
+				writer.Write(foreign_key.pk_name);
+				writer.Write(Value::SMALLINT(SQL_NOT_DEFERRABLE));
+			}
+		}
+		return writer.Finish();
+	});
+}
+
+//===--------------------------------------------------------------------===//
+// SQLStatistics
+//===--------------------------------------------------------------------===//
+
+namespace {
+//! An index of a table, either the ART index of a PRIMARY KEY or UNIQUE constraint or one made by CREATE INDEX
+struct TableIndexInfo {
+	bool non_unique;
+	std::string name;
+	duckdb::vector<std::string> columns;
+};
+} // namespace
+
+//! The indexes of the table, unique ones first
+static duckdb::vector<TableIndexInfo> GetTableIndexes(duckdb::ClientContext &context, duckdb::TableCatalogEntry &table,
+                                                      bool unique_only) {
+	duckdb::vector<TableIndexInfo> indexes;
+	for (auto &constraint : table.GetConstraints()) {
+		if (constraint->type != duckdb::ConstraintType::UNIQUE) {
+			continue;
+		}
+		auto &unique = constraint->Cast<duckdb::UniqueConstraint>();
+		auto columns = GetUniqueColumns(table, unique);
+		auto name = GetConstraintName(table.name, columns, {}, unique.IsPrimaryKey() ? "pkey" : "key");
+		indexes.push_back({false, std::move(name), std::move(columns)});
+	}
+	table.ParentSchema().Scan(context, duckdb::CatalogType::INDEX_ENTRY, [&](duckdb::CatalogEntry &entry) {
+		auto &index = entry.Cast<duckdb::IndexCatalogEntry>();
+		if (index.GetTableName() != table.name || (unique_only && !index.IsUnique())) {
+			return;
+		}
+		auto &expressions = index.parsed_expressions.empty() ? index.expressions : index.parsed_expressions;
+		duckdb::vector<std::string> columns;
+		for (auto &expression : expressions) {
+			// an index on an expression reports the expression as its column
+			if (expression->GetExpressionType() == duckdb::ExpressionType::COLUMN_REF) {
+				columns.push_back(expression->Cast<duckdb::ColumnRefExpression>().GetColumnName());
+			} else {
+				columns.push_back(expression->ToString());
+			}
+		}
+		indexes.push_back({!index.IsUnique(), index.name, std::move(columns)});
+	});
+	std::sort(indexes.begin(), indexes.end(), [](const TableIndexInfo &left, const TableIndexInfo &right) {
+		return std::tie(left.non_unique, left.name) < std::tie(right.non_unique, right.name);
+	});
+	return indexes;
+}
+
+//! CARDINALITY is an SQLINTEGER, larger row counts are reported as its maximum
+static Value CardinalityValue(duckdb::optional_idx cardinality) {
+	if (!cardinality.IsValid()) {
+		return Value(LogicalType::INTEGER);
+	}
+	auto max_cardinality = static_cast<duckdb::idx_t>(duckdb::NumericLimits<int32_t>::Maximum());
+	return Value::INTEGER(static_cast<int32_t>(std::min(cardinality.GetIndex(), max_cardinality)));
+}
+
+//! Number of rows of the table visible to the transaction. The counts of the row groups that have neither deleted nor
+//! uncommitted rows are exact in the storage, the row ids of the table are scanned otherwise. The scan only covers the
+//! committed rows, the rows appended by the transaction are kept in its local storage.
+static duckdb::optional_idx GetExactCardinality(duckdb::ClientContext &context, duckdb::TableCatalogEntry &table) {
+	if (!table.IsDuckTable()) {
+		// tables of other catalogs only provide their estimate
+		return table.GetStorageInfo(context).cardinality;
+	}
+	auto &storage = table.GetStorage();
+	duckdb::idx_t count = 0;
+	bool exact = true;
+	for (auto &partition : storage.GetPartitionStats(context)) {
+		if (partition.count_type != duckdb::CountType::COUNT_EXACT) {
+			exact = false;
+			break;
+		}
+		count += partition.count;
+	}
+	if (exact) {
+		return count;
+	}
+
+	// the row id column is not stored, the scan only checks the visibility of the rows
+	auto &transaction = duckdb::DuckTransaction::Get(context, table.ParentCatalog());
+	duckdb::vector<duckdb::StorageIndex> column_ids {duckdb::StorageIndex()};
+	duckdb::TableScanState state;
+	storage.InitializeScan(context, transaction, state, column_ids);
+	duckdb::DataChunk chunk;
+	chunk.Initialize(context, {LogicalType(LogicalType::ROW_TYPE)});
+	count = 0;
+	while (true) {
+		chunk.Reset();
+		storage.Scan(transaction, chunk, state);
+		if (chunk.size() == 0) {
+			break;
+		}
+		count += chunk.size();
+	}
+	return count + duckdb::LocalStorage::Get(transaction).AddedRows(storage);
+}
+
+//! Number of distinct values of an index on a single column, taken from the statistics of the column
+static duckdb::optional_idx GetIndexCardinality(duckdb::ClientContext &context, duckdb::TableCatalogEntry &table,
+                                                const TableIndexInfo &index, duckdb::optional_idx table_cardinality) {
+	if (index.columns.size() != 1 || !table.ColumnExists(index.columns[0])) {
+		return duckdb::optional_idx();
+	}
+	auto &column = table.GetColumn(index.columns[0]);
+	auto stats = table.GetStatistics(context, column.Logical().index);
+	if (!stats || stats->GetDistinctCount() == 0) {
+		return duckdb::optional_idx();
+	}
+	// the distinct count is estimated, it can exceed the row count
+	auto distinct_count = stats->GetDistinctCount();
+	if (table_cardinality.IsValid()) {
+		distinct_count = std::min(distinct_count, table_cardinality.GetIndex());
+	}
+	return distinct_count;
+}
+
+SQLRETURN duckdb::CatalogStatisticsStmt(OdbcHandleStmt *hstmt, const CatalogNameFilter &catalog_filter_p,
+                                        const CatalogNameFilter &schema_filter, const CatalogNameFilter &table_filter,
+                                        SQLUSMALLINT unique, SQLUSMALLINT reserved) {
+	static const vector<string> names {"TABLE_CAT",        "TABLE_SCHEM", "TABLE_NAME",  "NON_UNIQUE", "INDEX_QUALIFIER",
+	                                   "INDEX_NAME",       "TYPE",        "ORDINAL_POSITION", "COLUMN_NAME",
+	                                   "ASC_OR_DESC",      "CARDINALITY", "PAGES",       "FILTER_CONDITION"};
+	static const vector<LogicalType> types {
+	    LogicalType::VARCHAR, LogicalType::VARCHAR,  LogicalType::VARCHAR,  LogicalType::SMALLINT, LogicalType::VARCHAR,
+	    LogicalType::VARCHAR, LogicalType::SMALLINT, LogicalType::SMALLINT, LogicalType::VARCHAR,  LogicalType::VARCHAR,
+	    LogicalType::INTEGER, LogicalType::INTEGER,  LogicalType::VARCHAR};
+
+	auto catalog_filter = catalog_filter_p.Excluding(hstmt->dbc->metadata_excluded_catalogs);
+	// the row counts change without a change of the catalog, the result is not cached
+	auto key = "SQLStatistics:" + catalog_filter.ToString() + schema_filter.ToString() + table_filter.ToString() +
+	           std::to_string(unique) + ":" + std::to_string(reserved);
+	return ExecMetadataStmt(hstmt, "SQLStatistics", key, names, types, [&](ClientContext &context) {
+		std::vector<reference<TableCatalogEntry>> tables;
+		ScanTables(context, catalog_filter, schema_filter, table_filter,
+		           [&](TableCatalogEntry &table) { tables.push_back(table); });
+		std::sort(tables.begin(), tables.end(), [](TableCatalogEntry &left, TableCatalogEntry &right) {
+			return std::tie(left.ParentCatalog().GetName(), left.ParentSchema().name, left.name) <
+			       std::tie(right.ParentCatalog().GetName(), right.ParentSchema().name, right.name);
+		});
+
+		MetadataRowWriter writer(context, types);
+		for (auto &table_ref : tables) {
+			auto &table = table_ref.get();
+			auto &catalog_name = table.ParentCatalog().GetName();
+			auto &schema_name = table.ParentSchema().name;
+			// the row count kept by the storage includes deleted rows that have not been vacuumed yet
+			auto table_cardinality = reserved == SQL_ENSURE ? GetExactCardinality(context, table)
+			                                                : table.GetStorageInfo(context).cardinality;
+			auto cardinality = CardinalityValue(table_cardinality);
+
+			writer.NextRow();
+			writer.Write(Value(catalog_name));
+			writer.Write(Value(schema_name));
+			writer.Write(Value(table.name));
+			writer.Write(Value(LogicalType::SMALLINT));
+			writer.Write(Value(LogicalType::VARCHAR));
+			writer.Write(Value(LogicalType::VARCHAR));
+			writer.Write(Value::SMALLINT(SQL_TABLE_STAT));
+			writer.Write(Value(LogicalType::SMALLINT));
+			writer.Write(Value(LogicalType::VARCHAR));
+			writer.Write(Value(LogicalType::VARCHAR));
+			writer.Write(cardinality);
+			writer.Write(Value(LogicalType::INTEGER));
+			writer.Write(Value(LogicalType::VARCHAR));
+
+			for (auto &index : GetTableIndexes(context, table, unique == SQL_INDEX_UNIQUE)) {
+				for (idx_t i = 0; i < index.columns.size(); i++) {
+					writer.NextRow();
+					writer.Write(Value(catalog_name));
+					writer.Write(Value(schema_name));
+					writer.Write(Value(table.name));
+					writer.Write(Value::SMALLINT(index.non_unique ? SQL_TRUE : SQL_FALSE));
+					writer.Write(Value(schema_name));
+					writer.Write(Value(index.name));
+					// ART indexes are neither clustered nor hashed
+					writer.Write(Value::SMALLINT(SQL_INDEX_OTHER));
+					writer.Write(Value::SMALLINT(static_cast<int16_t>(i + 1)));
+					writer.Write(Value(index.columns[i]));
+					writer.Write(Value("A"));
+					writer.Write(index.non_unique
+					                 ? CardinalityValue(GetIndexCardinality(context, table, index, table_cardinality))
+					                 : cardinality);
+					writer.Write(Value(LogicalType::INTEGER));
+					writer.Write(Value(LogicalType::VARCHAR));
+				}
+			}
+		}
+		return writer.Finish();
+	}, false);
+}
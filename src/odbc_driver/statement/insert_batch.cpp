@@ -0,0 +1,166 @@
+#include "insert_batch.hpp"
+
+#include "duckdb/common/types/column/column_data_collection.hpp"
+#include "duckdb/main/materialized_query_result.hpp"
+#include "duckdb/main/prepared_statement_data.hpp"
+#include "duckdb/parser/expression/parameter_expression.hpp"
+#include "duckdb/parser/keyword_helper.hpp"
+#include "duckdb/parser/parser.hpp"
+#include "duckdb/parser/statement/insert_statement.hpp"
+#include "duckdb/parser/tableref/expressionlistref.hpp"
+
+using duckdb::InsertBatch;
+using duckdb::KeywordHelper;
+using duckdb::LogicalType;
+using duckdb::Value;
+
+const std::string InsertBatch::BATCH_SIZE_OPTION = "insert_batching";
+
+//! Name under which the buffered rows are referenced in the flush query
+static const std::string BUFFERED_ROWS_NAME = "odbc_insert_batch";
+
+InsertBatch::InsertBatch(string flush_query_p, vector<LogicalType> types_p, vector<idx_t> param_idxs_p,
+                         idx_t batch_size_p)
+    : flush_query(std::move(flush_query_p)), types(std::move(types_p)), param_idxs(std::move(param_idxs_p)),
+      batch_size(batch_size_p) {
+}
+
+duckdb::unique_ptr<InsertBatch> InsertBatch::TryCreate(OdbcHandleStmt &hstmt, idx_t batch_size) {
+	if (batch_size == 0 || !hstmt.stmt || hstmt.stmt->HasError()) {
+		return nullptr;
+	}
+	if (hstmt.stmt->GetStatementType() != StatementType::INSERT_STATEMENT ||
+	    !hstmt.stmt->GetStatementProperties().bound_all_parameters) {
+		return nullptr;
+	}
+
+	// Only a plain 'INSERT INTO t [(cols)] VALUES (?, ...)' can be batched, the parser is used to
+	// rule out CTEs, RETURNING, ON CONFLICT, expressions in the VALUES list, etc.
+	Parser parser;
+	try {
+		parser.ParseQuery(hstmt.stmt->query);
+	} catch (std::exception &ex) {
+		return nullptr;
+	}
+	if (parser.statements.size() != 1 || parser.statements[0]->type != StatementType::INSERT_STATEMENT) {
+		return nullptr;
+	}
+	auto &insert = parser.statements[0]->Cast<InsertStatement>();
+	if (!insert.cte_map.map.empty() || !insert.returning_list.empty() || insert.on_conflict_info ||
+	    insert.default_values || insert.column_order != InsertColumnOrder::INSERT_BY_POSITION) {
+		return nullptr;
+	}
+	auto values_list = insert.GetValuesList();
+	if (!values_list || values_list->values.size() != 1) {
+		return nullptr;
+	}
+
+	auto &row = values_list->values[0];
+	auto param_count = hstmt.stmt->named_param_map.size();
+	auto expected_types = hstmt.stmt->GetExpectedParameterTypes();
+	vector<LogicalType> types;
+	vector<idx_t> param_idxs;
+	for (auto &expr : row) {
+		if (expr->GetExpressionType() != ExpressionType::VALUE_PARAMETER) {
+			return nullptr;
+		}
+		auto &identifier = expr->Cast<ParameterExpression>().identifier;
+		// parameter values are passed by position, their identifiers are "1", "2", ...
+		idx_t param_idx = 0;
+		for (; param_idx < param_count; param_idx++) {
+			if (identifier == std::to_string(param_idx + 1)) {
+				break;
+			}
+		}
+		auto type_entry = expected_types.find(identifier);
+		if (param_idx == param_count || type_entry == expected_types.end()) {
+			return nullptr;
+		}
+		auto &type = type_entry->second;
+		if (type.id() == LogicalTypeId::UNKNOWN || type.id() == LogicalTypeId::SQLNULL ||
+		    type.id() == LogicalTypeId::ANY) {
+			return nullptr;
+		}
+		param_idxs.push_back(param_idx);
+		types.push_back(type);
+	}
+
+	string flush_query = "INSERT INTO ";
+	if (!insert.catalog.empty()) {
+		flush_query += KeywordHelper::WriteOptionallyQuoted(insert.catalog) + ".";
+	}
+	if (!insert.schema.empty()) {
+		flush_query += KeywordHelper::WriteOptionallyQuoted(insert.schema) + ".";
+	}
+	flush_query += KeywordHelper::WriteOptionallyQuoted(insert.table);
+	if (!insert.columns.empty()) {
+		flush_query += " (";
+		for (idx_t i = 0; i < insert.columns.size(); i++) {
+			if (i > 0) {
+				flush_query += ", ";
+			}
+			flush_query += KeywordHelper::WriteOptionallyQuoted(insert.columns[i]);
+		}
+		flush_query += ")";
+	}
+	flush_query += " SELECT * FROM " + BUFFERED_ROWS_NAME;
+
+	return make_uniq<InsertBatch>(std::move(flush_query), std::move(types), std::move(param_idxs), batch_size);
+}
+
+void InsertBatch::Append(Connection &conn, vector<Value> &values) {
+	// cast the values up front, so a conversion error cannot leave a partially appended row behind
+	vector<Value> row;
+	row.reserve(param_idxs.size());
+	for (idx_t col_idx = 0; col_idx < param_idxs.size(); col_idx++) {
+		D_ASSERT(param_idxs[col_idx] < values.size());
+		row.push_back(values[param_idxs[col_idx]].DefaultCastAs(types[col_idx]));
+	}
+
+	if (!appender) {
+		appender = make_uniq<QueryAppender>(conn, flush_query, types, vector<string>(), BUFFERED_ROWS_NAME);
+	}
+	appender->BeginRow();
+	for (auto &value : row) {
+		appender->Append<Value>(value);
+	}
+	appender->EndRow();
+	row_count++;
+}
+
+void InsertBatch::Flush() {
+	if (IsEmpty()) {
+		return;
+	}
+	row_count = 0;
+	try {
+		appender->Flush();
+	} catch (std::exception &ex) {
+		appender->Clear();
+		throw;
+	}
+}
+
+void InsertBatch::Clear() {
+	if (appender) {
+		appender->Clear();
+	}
+	row_count = 0;
+}
+
+duckdb::unique_ptr<duckdb::QueryResult> InsertBatch::BufferedRowResult(ClientContext &context) {
+	vector<LogicalType> result_types {LogicalType::BIGINT};
+	auto &allocator = Allocator::DefaultAllocator();
+	auto collection = make_uniq<ColumnDataCollection>(allocator, result_types);
+	DataChunk chunk;
+	chunk.Initialize(allocator, result_types);
+	chunk.SetValue(0, 0, Value::BIGINT(1));
+	chunk.SetCardinality(1);
+	collection->Append(chunk);
+
+	// reported like the result of an executed INSERT, which is not a cursor
+	StatementProperties properties;
+	properties.return_type = StatementReturnType::CHANGED_ROWS;
+	return make_uniq<MaterializedQueryResult>(StatementType::INSERT_STATEMENT, properties, vector<string> {"Count"},
+	                                          std::move(collection), context.GetClientProperties());
+}
@@ -0,0 +1,225 @@
+#include "metadata_cache.hpp"
+
+#include "handle_functions.hpp"
+#include "odbc_fetch.hpp"
+#include "query_watchdog.hpp"
+#include "statement_cancel.hpp"
+#include "statement_functions.hpp"
+
+#include "duckdb/catalog/catalog.hpp"
+#include "duckdb/main/attached_database.hpp"
+#include "duckdb/main/database_manager.hpp"
+#include "duckdb/main/prepared_statement_data.hpp"
+#include "duckdb/transaction/transaction.hpp"
+
+#include <algorithm>
+#include <functional>
+
+using duckdb::CachedMetadataResult;
+using duckdb::SQLStateType;
+
+//! Materializes a metadata result on a cache miss, the argument is the catalog state the result is valid for
+typedef std::function<duckdb::shared_ptr<CachedMetadataResult>(const std::string &)> MetadataMaterializer;
+
+//! Prefix of the object cache keys, the rest of the key is the function and its arguments
+static const char *METADATA_CACHE_PREFIX = "odbc_metadata:";
+
+namespace duckdb {
+
+//! Scans a cached result set with its own scan state, so several cursors can read the same entry
+class CachedMetadataQueryResult : public QueryResult {
+public:
+	CachedMetadataQueryResult(shared_ptr<CachedMetadataResult> entry_p, ClientProperties client_properties,
+	                          ColumnDataScanProperties scan_properties)
+	    : QueryResult(QueryResultType::MATERIALIZED_RESULT, entry_p->statement_type, entry_p->properties,
+	                  entry_p->collection->Types(), entry_p->names, std::move(client_properties)),
+	      entry(std::move(entry_p)) {
+		entry->collection->InitializeScan(scan_state, scan_properties);
+	}
+
+	string ToString() override {
+		return entry->collection->ToString();
+	}
+
+protected:
+	unique_ptr<DataChunk> FetchInternal() override {
+		auto result = make_uniq<DataChunk>();
+		entry->collection->InitializeScanChunk(*result);
+		entry->collection->Scan(scan_state, *result);
+		if (result->size() == 0) {
+			return nullptr;
+		}
+		return result;
+	}
+
+private:
+	shared_ptr<CachedMetadataResult> entry;
+	ColumnDataScanState scan_state;
+};
+
+} // namespace duckdb
+
+CachedMetadataResult::CachedMetadataResult(string catalog_state_p, StatementType statement_type_p,
+                                           StatementProperties properties_p, vector<string> names_p,
+                                           unique_ptr<ColumnDataCollection> collection_p)
+    : catalog_state(std::move(catalog_state_p)), statement_type(statement_type_p), properties(std::move(properties_p)),
+      names(std::move(names_p)), collection(std::move(collection_p)) {
+}
+
+//! Returns the identity and version of every attached catalog, or an empty string when a metadata result
+//! cannot be cached: a catalog without a version, uncommitted DDL or temporary objects of the connection
+static std::string GetCatalogState(duckdb::ClientContext &context) {
+	duckdb::vector<std::pair<duckdb::idx_t, duckdb::idx_t>> versions;
+	bool cacheable = true;
+	try {
+		context.RunFunctionInTransaction([&]() {
+			for (auto &database : duckdb::DatabaseManager::Get(context).GetDatabases(context)) {
+				auto &catalog = database->GetCatalog();
+				duckdb::Transaction::Get(context, catalog);
+				auto version = catalog.GetCatalogVersion(context);
+				if (!version.IsValid() || version.GetIndex() >= duckdb::TRANSACTION_ID_START) {
+					cacheable = false;
+					return;
+				}
+				if (database->IsTemporary()) {
+					// the temporary catalog is private to the connection, it must not have been used at all
+					if (version.GetIndex() != 0) {
+						cacheable = false;
+						return;
+					}
+					continue;
+				}
+				versions.emplace_back(catalog.GetOid(), version.GetIndex());
+			}
+		});
+	} catch (std::exception &) {
+		return std::string();
+	}
+	if (!cacheable) {
+		return std::string();
+	}
+	// the order of the attached databases is not stable
+	std::sort(versions.begin(), versions.end());
+	std::string state;
+	for (auto &version : versions) {
+		state += std::to_string(version.first) + ":" + std::to_string(version.second) + ";";
+	}
+	return state;
+}
+
+//! Opens a cursor over the result and fetches its first chunk
+static SQLRETURN OpenMetadataResult(duckdb::OdbcHandleStmt *hstmt, duckdb::shared_ptr<CachedMetadataResult> entry,
+                                    duckdb::ColumnDataScanProperties scan_properties) {
+	auto &context = *hstmt->dbc->conn->context;
+	hstmt->res = duckdb::make_uniq<duckdb::CachedMetadataQueryResult>(std::move(entry), context.GetClientProperties(),
+	                                                                  scan_properties);
+	hstmt->open = true;
+	if (hstmt->rows_fetched_ptr) {
+		*hstmt->rows_fetched_ptr = 0;
+	}
+	auto fetch_ret = hstmt->odbc_fetcher->FetchFirst(hstmt);
+	if (fetch_ret == SQL_ERROR) {
+		return fetch_ret;
+	}
+	return SQL_SUCCESS;
+}
+
+//! Serves the result from the cache, materializes it on a miss and caches it when the catalog state allows
+static SQLRETURN ServeMetadataResult(duckdb::OdbcHandleStmt *hstmt, const std::string &component,
+                                     const std::string &key, const std::string &catalog_state,
+                                     const MetadataMaterializer &materialize) {
+	auto &context = *hstmt->dbc->conn->context;
+	auto &cache = duckdb::ObjectCache::GetObjectCache(context);
+
+	duckdb::shared_ptr<CachedMetadataResult> entry;
+	if (!catalog_state.empty()) {
+		entry = cache.Get<CachedMetadataResult>(key);
+	}
+	if (!entry || entry->catalog_state != catalog_state) {
+		try {
+			entry = materialize(catalog_state);
+		} catch (std::exception &ex) {
+			duckdb::ErrorData error(ex);
+			return duckdb::SetDiagnosticRecord(hstmt, SQL_ERROR, component, error.Message(), SQLStateType::ST_HY000,
+			                                   hstmt->dbc->GetDataSourceName());
+		}
+		// a DDL committed in between may or may not be visible to the result, such a result is not cached
+		if (!catalog_state.empty() && GetCatalogState(context) == catalog_state) {
+			cache.Put(key, entry);
+		}
+	}
+
+	// the fetched chunks must not point into the entry, it can be evicted while the cursor is open
+	return OpenMetadataResult(hstmt, std::move(entry), duckdb::ColumnDataScanProperties::DISALLOW_ZERO_COPY);
+}
+
+//! Runs the checks of an execution, closes the previous result of the statement and describes the result columns
+static SQLRETURN BeginMetadataStmt(duckdb::OdbcHandleStmt *hstmt, const std::string &component,
+                                   const duckdb::vector<std::string> &names,
+                                   const duckdb::vector<duckdb::LogicalType> &types) {
+	if (hstmt->pending) {
+		return duckdb::SetDiagnosticRecord(hstmt, SQL_ERROR, component,
+		                                   "The asynchronous execution is still in progress", SQLStateType::ST_HY010,
+		                                   hstmt->dbc->GetDataSourceName());
+	}
+	SQLRETURN ret = duckdb::CheckNoAsyncExecution(hstmt, component);
+	if (ret != SQL_SUCCESS) {
+		return ret;
+	}
+	ret = hstmt->dbc->SpillStreamingResults(hstmt, hstmt);
+	if (ret != SQL_SUCCESS) {
+		return ret;
+	}
+	ret = hstmt->dbc->FlushInsertBatch(hstmt);
+	if (ret != SQL_SUCCESS) {
+		return ret;
+	}
+	duckdb::PrepareQuery(hstmt);
+
+	// the rows are not computed by a query, a statement only describing the result columns stands in for it
+	auto &data = hstmt->dbc->metadata_statements[component];
+	if (!data) {
+		data = duckdb::make_shared_ptr<duckdb::PreparedStatementData>(duckdb::StatementType::SELECT_STATEMENT);
+		data->names = names;
+		data->types = types;
+	}
+	D_ASSERT(data->names == names && data->types == types);
+	hstmt->stmt = duckdb::make_uniq<duckdb::PreparedStatement>(hstmt->dbc->conn->context, data, component,
+	                                                           duckdb::case_insensitive_map_t<duckdb::idx_t>());
+	duckdb::FinalizeStmt(hstmt);
+	return SQL_SUCCESS;
+}
+
+SQLRETURN duckdb::ExecMetadataStmt(OdbcHandleStmt *hstmt, const string &component, const string &key,
+                                   const vector<string> &names, const vector<LogicalType> &types,
+                                   const MetadataProducer &producer, bool cacheable) {
+	SQLRETURN ret = BeginMetadataStmt(hstmt, component, names, types);
+	if (ret != SQL_SUCCESS) {
+		return ret;
+	}
+
+	// the catalog walk is short, an asynchronous execution completes synchronously
+	auto &context = *hstmt->dbc->conn->context;
+	auto catalog_state = cacheable ? GetCatalogState(context) : string();
+	StatementCancelScope cancel_scope(*hstmt);
+	QueryTimeoutGuard timeout(*hstmt);
+	ret = ServeMetadataResult(hstmt, component, METADATA_CACHE_PREFIX + key, catalog_state,
+	                          [&](const string &state) {
+		                          unique_ptr<ColumnDataCollection> collection;
+		                          context.RunFunctionInTransaction([&]() { collection = producer(context); });
+		                          return make_shared_ptr<CachedMetadataResult>(state, StatementType::SELECT_STATEMENT,
+		                                                                       StatementProperties(), names,
+		                                                                       std::move(collection));
+	                          });
+	return cancel_scope.Finish(timeout.Finish(*hstmt, ret));
+}
+
+SQLRETURN duckdb::ExecStaticMetadataStmt(OdbcHandleStmt *hstmt, const string &component,
+                                         shared_ptr<CachedMetadataResult> result) {
+	SQLRETURN ret = BeginMetadataStmt(hstmt, component, result->names, result->collection->Types());
+	if (ret != SQL_SUCCESS) {
+		return ret;
+	}
+	// the result is never freed, the fetched chunks can point into it
+	return OpenMetadataResult(hstmt, std::move(result), ColumnDataScanProperties::ALLOW_ZERO_COPY);
+}
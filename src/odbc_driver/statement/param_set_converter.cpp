@@ -0,0 +1,57 @@
+#include "param_set_converter.hpp"
+
+using duckdb::ParamSetConverter;
+
+ParamSetConverter::ParamSetConverter(ParameterDescriptor &param_desc_p, idx_t first_set, idx_t set_count)
+    : param_desc(param_desc_p) {
+	thread = std::thread([this, first_set, set_count]() { Run(first_set, set_count); });
+}
+
+ParamSetConverter::~ParamSetConverter() {
+	{
+		lock_guard<mutex> guard(lock);
+		stop = true;
+	}
+	slot_changed.notify_all();
+	thread.join();
+}
+
+bool ParamSetConverter::Take(idx_t set_idx, PreconvertedParamSet &set) {
+	unique_lock<mutex> guard(lock);
+	slot_changed.wait(guard, [&]() { return slot_full || stop; });
+	if (!slot_full) {
+		return false;
+	}
+	D_ASSERT(slot.set_idx == set_idx);
+	set = std::move(slot);
+	slot_full = false;
+	slot_changed.notify_all();
+	return true;
+}
+
+void ParamSetConverter::Run(idx_t first_set, idx_t set_count) {
+	PreconvertedParamSet set;
+	for (idx_t set_idx = first_set; set_idx < set_count; set_idx++) {
+		bool converted;
+		try {
+			converted = param_desc.PreconvertParamSet(set_idx, set);
+		} catch (std::exception &) {
+			converted = false;
+		}
+		unique_lock<mutex> guard(lock);
+		if (!converted) {
+			// the executing thread converts the set itself and reports why it failed
+			break;
+		}
+		slot_changed.wait(guard, [&]() { return !slot_full || stop; });
+		if (stop) {
+			return;
+		}
+		slot = std::move(set);
+		slot_full = true;
+		slot_changed.notify_all();
+	}
+	lock_guard<mutex> guard(lock);
+	stop = true;
+	slot_changed.notify_all();
+}
@@ -0,0 +1,120 @@
+#include "query_watchdog.hpp"
+
+#include "handle_functions.hpp"
+#include "odbc_fetch.hpp"
+
+using duckdb::QueryTimeoutGuard;
+using duckdb::QueryWatchdog;
+
+QueryWatchdog::~QueryWatchdog() {
+	{
+		lock_guard<mutex> guard(lock);
+		stop = true;
+	}
+	timers_armed.notify_one();
+	if (thread.joinable()) {
+		thread.join();
+	}
+}
+
+QueryWatchdog &QueryWatchdog::Get() {
+	static QueryWatchdog watchdog;
+	return watchdog;
+}
+
+duckdb::idx_t QueryWatchdog::Arm(shared_ptr<ClientContext> context, SQLULEN timeout_seconds) {
+	D_ASSERT(timeout_seconds > 0);
+	idx_t ticks = MaxValue<idx_t>(timeout_seconds * 1000 / TICK_MILLISECONDS, 1);
+
+	lock_guard<mutex> guard(lock);
+	if (!thread.joinable()) {
+		wheel.resize(WHEEL_SLOTS);
+		thread = std::thread([this]() { Run(); });
+	}
+	auto timer_id = next_timer_id++;
+	Timer timer;
+	timer.context = std::move(context);
+	timer.rounds = (ticks - 1) / WHEEL_SLOTS;
+	timers.emplace(timer_id, std::move(timer));
+	wheel[(current_slot + ticks) % WHEEL_SLOTS].push_back(timer_id);
+	if (timers.size() == 1) {
+		timers_armed.notify_one();
+	}
+	return timer_id;
+}
+
+bool QueryWatchdog::Disarm(idx_t timer_id) {
+	lock_guard<mutex> guard(lock);
+	auto entry = timers.find(timer_id);
+	D_ASSERT(entry != timers.end());
+	bool fired = entry->second.fired;
+	// the id stays in its wheel slot, it is skipped once the slot comes around
+	timers.erase(entry);
+	return fired;
+}
+
+void QueryWatchdog::Run() {
+	auto tick = std::chrono::milliseconds(TICK_MILLISECONDS);
+	unique_lock<mutex> guard(lock);
+	while (!stop) {
+		if (timers.empty()) {
+			timers_armed.wait(guard, [&]() { return stop || !timers.empty(); });
+			continue;
+		}
+		auto next_tick = std::chrono::steady_clock::now() + tick;
+		if (timers_armed.wait_until(guard, next_tick, [&]() { return stop; })) {
+			break;
+		}
+
+		current_slot = (current_slot + 1) % WHEEL_SLOTS;
+		auto &slot = wheel[current_slot];
+		idx_t kept = 0;
+		for (auto timer_id : slot) {
+			auto entry = timers.find(timer_id);
+			if (entry == timers.end()) {
+				continue;
+			}
+			auto &timer = entry->second;
+			if (timer.rounds > 0) {
+				timer.rounds--;
+				slot[kept++] = timer_id;
+				continue;
+			}
+			// only sets a flag checked by the executing thread, so it is done while holding the lock
+			timer.fired = true;
+			timer.context->Interrupt();
+		}
+		slot.resize(kept);
+	}
+}
+
+QueryTimeoutGuard::QueryTimeoutGuard(OdbcHandleStmt &hstmt) {
+	if (hstmt.query_timeout > 0 && hstmt.dbc->conn) {
+		timer_id = QueryWatchdog::Get().Arm(hstmt.dbc->conn->context, hstmt.query_timeout);
+	}
+}
+
+QueryTimeoutGuard::~QueryTimeoutGuard() {
+	if (timer_id != 0) {
+		QueryWatchdog::Get().Disarm(timer_id);
+	}
+}
+
+SQLRETURN QueryTimeoutGuard::Finish(OdbcHandleStmt &hstmt, SQLRETURN ret) {
+	if (timer_id == 0) {
+		return ret;
+	}
+	bool fired = QueryWatchdog::Get().Disarm(timer_id);
+	timer_id = 0;
+	if (!fired) {
+		return ret;
+	}
+
+	hstmt.res.reset();
+	hstmt.odbc_fetcher->ClearChunks();
+	hstmt.open = false;
+	// the interrupted query reported its own error, the timeout is the reason the application must see
+	hstmt.odbc_diagnostic->Clean();
+	return SetDiagnosticRecord(&hstmt, SQL_ERROR, "SQLExecute", "Query timeout expired", SQLStateType::ST_HYT00,
+	                           hstmt.dbc->GetDataSourceName());
+}
@@ -0,0 +1,37 @@
+#include "statement_cancel.hpp"
+
+#include "handle_functions.hpp"
+#include "odbc_fetch.hpp"
+
+using duckdb::StatementCancelScope;
+
+StatementCancelScope::StatementCancelScope(OdbcHandleStmt &hstmt_p) : hstmt(hstmt_p) {
+	lock_guard<mutex> guard(hstmt.dbc->running_lock);
+	previous_stmt = hstmt.dbc->running_stmt;
+	hstmt.dbc->running_stmt = &hstmt;
+}
+
+StatementCancelScope::~StatementCancelScope() {
+	lock_guard<mutex> guard(hstmt.dbc->running_lock);
+	hstmt.dbc->running_stmt = previous_stmt;
+	// a cancellation arriving after the query finished leaves the interrupt flag set, the next fetch of a
+	// streaming result on the connection must not see it
+	if ((hstmt.canceled.exchange(false) || canceled) && hstmt.dbc->conn) {
+		hstmt.dbc->conn->context->ClearInterrupt();
+	}
+}
+
+SQLRETURN StatementCancelScope::Finish(SQLRETURN ret) {
+	if (!hstmt.canceled.exchange(false)) {
+		return ret;
+	}
+	canceled = true;
+	hstmt.CancelPending();
+	hstmt.res.reset();
+	hstmt.odbc_fetcher->ClearChunks();
+	hstmt.open = false;
+	// the interrupted query reported its own error, the cancellation is the reason the application must see
+	hstmt.odbc_diagnostic->Clean();
+	return SetDiagnosticRecord(&hstmt, SQL_ERROR, "SQLCancel", "Operation canceled", SQLStateType::ST_HY008,
+	                           hstmt.dbc->GetDataSourceName());
+}
@@ -1,10 +1,14 @@
 #include "statement_functions.hpp"
 #include "handle_functions.hpp"
+#include "insert_batch.hpp"
 #include "odbc_interval.hpp"
 #include "odbc_fetch.hpp"
 #include "odbc_utils.hpp"
 #include "descriptor.hpp"
+#include "param_set_converter.hpp"
 #include "parameter_descriptor.hpp"
+#include "query_watchdog.hpp"
+#include "statement_cancel.hpp"
 #include "widechar.hpp"
 
 #include "duckdb/common/types/timestamp.hpp"
@@ -20,6 +24,10 @@
 #include "duckdb/common/vector.hpp"
 #include "duckdb/common/enum_util.hpp"
 #include "duckdb/main/prepared_statement_data.hpp"
+#include "duckdb/planner/expression/bound_parameter_data.hpp"
+#include "duckdb/planner/planner.hpp"
+
+#include <chrono>
 
 using duckdb::date_t;
 using duckdb::Decimal;
@@ -38,6 +46,7 @@ using duckdb::Store;
 using duckdb::string_t;
 using duckdb::Timestamp;
 using duckdb::timestamp_t;
+using duckdb::Value;
 using duckdb::vector;
 
 void duckdb::PrepareQuery(OdbcHandleStmt *hstmt) {
@@ -50,6 +59,17 @@ void duckdb::PrepareQuery(OdbcHandleStmt *hstmt) {
 	}
 
 	hstmt->odbc_fetcher->ClearChunks();
+	hstmt->insert_batch.reset();
+}
+
+SQLRETURN duckdb::CheckNoAsyncExecution(OdbcHandleStmt *hstmt, const string &component) {
+	// any other query of the connection would invalidate the pending one
+	if (hstmt->dbc->async_stmt && hstmt->dbc->async_stmt != hstmt) {
+		return duckdb::SetDiagnosticRecord(hstmt, SQL_ERROR, component,
+		                                   "An asynchronous execution is in progress on the connection",
+		                                   SQLStateType::ST_HY010, hstmt->dbc->GetDataSourceName());
+	}
+	return SQL_SUCCESS;
 }
 
 SQLRETURN duckdb::FinalizeStmt(OdbcHandleStmt *hstmt) {
@@ -76,6 +96,7 @@ SQLRETURN duckdb::FinalizeStmt(OdbcHandleStmt *hstmt) {
 
 	// named_param_map is created on successfull parse stage, does not need to be corrected on rebind
 	hstmt->param_desc->ResetParams(static_cast<SQLSMALLINT>(hstmt->stmt->named_param_map.size()));
+	hstmt->ird_param_types_valid = false;
 
 	// Bound columns and IRD records depend on resulting columns. When
 	// bound_all_parameters=false, we don't have resulting columns defined, so
@@ -87,13 +108,271 @@ SQLRETURN duckdb::FinalizeStmt(OdbcHandleStmt *hstmt) {
 	return ret;
 }
 
-//! Execute stmt in a batch manner while there is a parameter set to process,
-//! the stmt is executed multiple times when there is a bound array of parameters in INSERT and UPDATE statements
-SQLRETURN duckdb::BatchExecuteStmt(OdbcHandleStmt *hstmt) {
-	SQLRETURN ret = SQL_SUCCESS;
+void duckdb::DescribeStmt(OdbcHandleStmt *hstmt) {
+	if (!hstmt->stmt || hstmt->stmt->HasError() || hstmt->stmt->GetStatementProperties().bound_all_parameters ||
+	    hstmt->ird_param_types_valid) {
+		return;
+	}
+	auto &data = *hstmt->stmt->data;
+	// only a query has result columns that do not depend on executing it
+	if (!data.unbound_statement || data.statement_type != StatementType::SELECT_STATEMENT) {
+		return;
+	}
+
+	vector<LogicalType> param_types;
+	for (idx_t i = 0; i < hstmt->stmt->named_param_map.size(); i++) {
+		LogicalType type;
+		if (!hstmt->param_desc->GetDeclaredType(i, type)) {
+			return;
+		}
+		param_types.push_back(std::move(type));
+	}
+
+	// the statement is bound and planned with NULL parameters of the declared types, the plan is never executed
+	auto &context = *hstmt->dbc->conn->context;
+	bool bound = false;
+	vector<string> names;
+	vector<LogicalType> types;
+	// a binder error leaves the columns empty, it must not abort the transaction of the connection. Starting or
+	// committing the transaction can throw as well, the describing functions never report it.
+	try {
+		context.RunFunctionInTransaction([&]() {
+			try {
+				Planner planner(context);
+				for (idx_t i = 0; i < param_types.size(); i++) {
+					planner.parameter_data.emplace(std::to_string(i + 1), BoundParameterData(Value(param_types[i])));
+				}
+				planner.CreatePlan(data.unbound_statement->Copy());
+				names = std::move(planner.names);
+				types = std::move(planner.types);
+				bound = true;
+			} catch (std::exception &) {
+			}
+		});
+	} catch (std::exception &) {
+		return;
+	}
+	if (!bound) {
+		return;
+	}
+
+	data.names = std::move(names);
+	data.types = std::move(types);
+	hstmt->bound_cols.resize(hstmt->stmt->ColumnCount());
+	hstmt->FillIRD();
+	// an execution with parameters of the same types does not re-fill the IRD records
+	hstmt->ird_param_types = std::move(param_types);
+	hstmt->ird_param_types_valid = true;
+}
+
+static void ResetStmtResult(duckdb::OdbcHandleStmt *hstmt) {
+	if (hstmt->res) {
+		hstmt->res.reset();
+	}
+	hstmt->odbc_fetcher->ClearChunks();
+
+	hstmt->open = false;
+	if (hstmt->rows_fetched_ptr) {
+		*hstmt->rows_fetched_ptr = 0;
+	}
+}
+
+static void SetExecutedParamTypes(duckdb::OdbcHandleStmt *hstmt, const duckdb::vector<Value> &values) {
+	if (!hstmt->stmt->GetStatementProperties().bound_all_parameters) {
+		hstmt->executed_param_types.clear();
+		for (auto &value : values) {
+			hstmt->executed_param_types.push_back(value.type());
+		}
+	}
+}
+
+//! Execute the prepared statement with a converted parameter set, returns false on error
+static bool ExecuteParamValues(duckdb::OdbcHandleStmt *hstmt, duckdb::vector<Value> &values) {
+	hstmt->res = hstmt->stmt->Execute(values);
+	if (hstmt->res->HasError()) {
+		return false;
+	}
+	SetExecutedParamTypes(hstmt, values);
+	hstmt->open = true;
+	return true;
+}
+
+//! Time an asynchronous execution runs tasks on the calling thread before returning SQL_STILL_EXECUTING
+static constexpr int64_t ASYNC_SLICE_MILLISECONDS = 10;
+
+//! Execute the statement with SQL_ATTR_ASYNC_ENABLE, every call runs the pending query for a bounded slice and
+//! returns SQL_STILL_EXECUTING until it is done. The result is materialized, so fetching it never blocks.
+static SQLRETURN AsyncExecuteStmt(duckdb::OdbcHandleStmt *hstmt) {
+	auto dbc = hstmt->dbc;
+	if (!hstmt->pending) {
+		ResetStmtResult(hstmt);
+		duckdb::vector<Value> values;
+		SQLRETURN ret = hstmt->param_desc->GetParamValues(values);
+		if (ret == SQL_NEED_DATA || ret == SQL_ERROR) {
+			return ret;
+		}
+		auto pending = hstmt->stmt->PendingQuery(values, false);
+		if (pending->HasError()) {
+			return duckdb::SetDiagnosticRecord(hstmt, SQL_ERROR, "AsyncExecuteStmt", pending->GetError(),
+			                                   SQLStateType::ST_HY000, dbc->GetDataSourceName());
+		}
+		hstmt->SwapPending(std::move(pending));
+		SetExecutedParamTypes(hstmt, values);
+		dbc->async_stmt = hstmt;
+	}
+
+	auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(ASYNC_SLICE_MILLISECONDS);
+	auto result = duckdb::PendingExecutionResult::RESULT_NOT_READY;
 	do {
-		ret = SingleExecuteStmt(hstmt);
+		if (hstmt->canceled) {
+			// reported as HY008 by the StatementCancelScope of the call
+			hstmt->CancelPending();
+			return SQL_ERROR;
+		}
+		result = hstmt->pending->ExecuteTask();
+		// the background threads keep working on the query between the calls
+	} while (result == duckdb::PendingExecutionResult::RESULT_NOT_READY && std::chrono::steady_clock::now() < deadline);
+	if (result != duckdb::PendingExecutionResult::EXECUTION_ERROR && !duckdb::PendingQueryResult::IsResultReady(result)) {
+		return SQL_STILL_EXECUTING;
+	}
+
+	auto pending = hstmt->SwapPending();
+	dbc->async_stmt = nullptr;
+	if (result == duckdb::PendingExecutionResult::EXECUTION_ERROR) {
+		return duckdb::SetDiagnosticRecord(hstmt, SQL_ERROR, "AsyncExecuteStmt", pending->GetError(),
+		                                   SQLStateType::ST_HY000, dbc->GetDataSourceName());
+	}
+	hstmt->res = pending->Execute();
+	if (hstmt->res->HasError()) {
+		return duckdb::SetDiagnosticRecord(hstmt, SQL_ERROR, "AsyncExecuteStmt", hstmt->res->GetError(),
+		                                   SQLStateType::ST_HY000, dbc->GetDataSourceName());
+	}
+	hstmt->open = true;
+	return SQL_SUCCESS;
+}
+
+//! Execute an array of parameter sets. For large arrays the ParamSetConverter converts the next set on another thread
+//! while a set is executed, the sets it cannot convert are converted here. When a set fails, the status array reports
+//! it as SQL_PARAM_ERROR and the sets that were not executed as SQL_PARAM_UNUSED.
+static SQLRETURN ArrayExecuteStmt(duckdb::OdbcHandleStmt *hstmt) {
+	auto &param_desc = *hstmt->param_desc;
+	auto ipd = param_desc.GetIPD();
+	auto array_size = param_desc.GetAPD()->header.sql_desc_array_size;
+
+	duckdb::unique_ptr<duckdb::ParamSetConverter> converter;
+	if (array_size - param_desc.GetParamSetIndex() >= duckdb::ParamSetConverter::MIN_PARAM_SETS) {
+		converter = duckdb::make_uniq<duckdb::ParamSetConverter>(param_desc, param_desc.GetParamSetIndex(), array_size);
+	}
+
+	SQLRETURN ret;
+	do {
+		ResetStmtResult(hstmt);
+		auto set_idx = param_desc.GetParamSetIndex();
+		duckdb::vector<Value> values;
+		duckdb::PreconvertedParamSet set;
+		if (converter && converter->Take(set_idx, set)) {
+			ret = param_desc.UsePreconvertedParamSet(set, values);
+		} else {
+			ret = param_desc.GetParamValues(values);
+		}
+		if (ret == SQL_NEED_DATA || ret == SQL_ERROR) {
+			return ret;
+		}
+		if (!ExecuteParamValues(hstmt, values)) {
+			auto status = ipd->header.sql_desc_array_status_ptr;
+			if (status) {
+				status[set_idx] = SQL_PARAM_ERROR;
+				for (SQLULEN i = set_idx + 1; i < array_size; i++) {
+					status[i] = SQL_PARAM_UNUSED;
+				}
+			}
+			return duckdb::SetDiagnosticRecord(hstmt, SQL_ERROR, "BatchExecuteStmt", hstmt->res->GetError(),
+			                                   duckdb::SQLStateType::ST_HY000, hstmt->dbc->GetDataSourceName());
+		}
 	} while (ret == SQL_STILL_EXECUTING);
+	return ret;
+}
+
+//! Buffer the execution of a plain INSERT when the 'insert_batching' option is set, the buffered rows are inserted
+//! once the batch is full, or when another statement is executed on the connection
+static SQLRETURN BufferInsertStmt(duckdb::OdbcHandleStmt *hstmt) {
+	ResetStmtResult(hstmt);
+
+	duckdb::vector<Value> values;
+	SQLRETURN ret = hstmt->param_desc->GetParamValues(values);
+	if (ret == SQL_NEED_DATA) {
+		// the statement is going to be executed by SQLParamData, after the rows buffered so far
+		auto flush_ret = hstmt->dbc->FlushInsertBatch(hstmt);
+		return flush_ret == SQL_SUCCESS ? ret : flush_ret;
+	}
+	if (ret == SQL_ERROR) {
+		return ret;
+	}
+
+	auto dbc = hstmt->dbc;
+	try {
+		hstmt->insert_batch->Append(*dbc->conn, values);
+	} catch (std::exception &ex) {
+		duckdb::ErrorData parsed_error(ex);
+		return duckdb::SetDiagnosticRecord(hstmt, SQL_ERROR, "BufferInsertStmt", parsed_error.RawMessage(),
+		                                   SQLStateType::ST_22018, dbc->GetDataSourceName());
+	}
+	dbc->insert_batch_stmt = hstmt;
+	if (hstmt->insert_batch->IsFull()) {
+		ret = dbc->FlushInsertBatch(hstmt);
+		if (ret != SQL_SUCCESS) {
+			return ret;
+		}
+	}
+
+	hstmt->res = duckdb::InsertBatch::BufferedRowResult(*dbc->conn->context);
+	hstmt->open = true;
+	return SQL_SUCCESS;
+}
+
+static SQLRETURN BatchExecuteStmtInternal(duckdb::OdbcHandleStmt *hstmt) {
+	SQLRETURN async_ret = duckdb::CheckNoAsyncExecution(hstmt, "SQLExecute");
+	if (async_ret != SQL_SUCCESS) {
+		return async_ret;
+	}
+
+	// the result of a catalog function is described by a statement that has no query to execute
+	if (hstmt->stmt && hstmt->stmt->success && !hstmt->stmt->data->unbound_statement) {
+		return duckdb::SetDiagnosticRecord(hstmt, SQL_ERROR, "SQLExecute", "No prepared statement to execute",
+		                                   duckdb::SQLStateType::ST_HY010, hstmt->dbc->GetDataSourceName());
+	}
+
+	// the cursors of the other statements stay open while this one runs
+	SQLRETURN spill_ret = hstmt->dbc->SpillStreamingResults(hstmt, hstmt);
+	if (spill_ret != SQL_SUCCESS) {
+		return spill_ret;
+	}
+
+	auto array_size = hstmt->param_desc->GetAPD()->header.sql_desc_array_size;
+	// rows buffered by the 'insert_batching' option are inserted before any other statement is executed
+	bool buffer_insert = hstmt->insert_batch && array_size == 1;
+	if (!buffer_insert || hstmt->dbc->insert_batch_stmt != hstmt) {
+		SQLRETURN flush_ret = hstmt->dbc->FlushInsertBatch(hstmt);
+		if (flush_ret != SQL_SUCCESS) {
+			return flush_ret;
+		}
+	}
+
+	SQLRETURN ret = SQL_SUCCESS;
+	if (buffer_insert) {
+		ret = BufferInsertStmt(hstmt);
+	} else if (!hstmt->param_desc->GetIPD()->records.empty() && array_size > 1) {
+		ret = ArrayExecuteStmt(hstmt);
+	} else if (hstmt->async_enable == SQL_ASYNC_ENABLE_ON && array_size == 1) {
+		ret = AsyncExecuteStmt(hstmt);
+		if (ret == SQL_STILL_EXECUTING) {
+			return ret;
+		}
+	} else {
+		do {
+			ret = SingleExecuteStmt(hstmt);
+		} while (ret == SQL_STILL_EXECUTING);
+	}
 
 	// Early exit on error
 	if (!SQL_SUCCEEDED(ret)) {
@@ -112,6 +391,13 @@ SQLRETURN duckdb::BatchExecuteStmt(OdbcHandleStmt *hstmt) {
 		D_ASSERT(hstmt->stmt->data);
 		D_ASSERT(hstmt->res);
 
+		// The result schema only depends on the parameter types, so IRD records built for the same
+		// parameter types are still valid and don't need to be re-filled
+		if (hstmt->ird_param_types_valid && hstmt->ird_param_types == hstmt->executed_param_types) {
+			hstmt->bound_cols.resize(hstmt->stmt->ColumnCount());
+			return ret;
+		}
+
 		// Copy up to date result types and names from the execution result
 		hstmt->stmt->data->types = hstmt->res->types;
 		hstmt->stmt->data->names = hstmt->res->names;
@@ -119,22 +405,24 @@ SQLRETURN duckdb::BatchExecuteStmt(OdbcHandleStmt *hstmt) {
 		// Correct bounded columns and re-fill IRD records
 		hstmt->bound_cols.resize(hstmt->stmt->ColumnCount());
 		hstmt->FillIRD();
+		hstmt->ird_param_types = hstmt->executed_param_types;
+		hstmt->ird_param_types_valid = true;
 	}
 
 	return ret;
 }
 
+//! Execute stmt in a batch manner while there is a parameter set to process,
+//! the stmt is executed multiple times when there is a bound array of parameters in INSERT and UPDATE statements
+SQLRETURN duckdb::BatchExecuteStmt(OdbcHandleStmt *hstmt) {
+	StatementCancelScope cancel_scope(*hstmt);
+	QueryTimeoutGuard timeout(*hstmt);
+	return cancel_scope.Finish(timeout.Finish(*hstmt, BatchExecuteStmtInternal(hstmt)));
+}
+
 //! Execute statement only once
 SQLRETURN duckdb::SingleExecuteStmt(OdbcHandleStmt *hstmt) {
-	if (hstmt->res) {
-		hstmt->res.reset();
-	}
-	hstmt->odbc_fetcher->ClearChunks();
-
-	hstmt->open = false;
-	if (hstmt->rows_fetched_ptr) {
-		*hstmt->rows_fetched_ptr = 0;
-	}
+	ResetStmtResult(hstmt);
 
 	duckdb::vector<Value> values;
 	SQLRETURN ret = hstmt->param_desc->GetParamValues(values);
@@ -142,13 +430,10 @@ SQLRETURN duckdb::SingleExecuteStmt(OdbcHandleStmt *hstmt) {
 		return ret;
 	}
 
-	hstmt->res = hstmt->stmt->Execute(values);
-
-	if (hstmt->res->HasError()) {
+	if (!ExecuteParamValues(hstmt, values)) {
 		return duckdb::SetDiagnosticRecord(hstmt, SQL_ERROR, "SingleExecuteStmt", hstmt->res->GetError(),
 		                                   duckdb::SQLStateType::ST_HY000, hstmt->dbc->GetDataSourceName());
 	}
-	hstmt->open = true;
 	if (ret == SQL_STILL_EXECUTING) {
 		return SQL_STILL_EXECUTING;
 	}
@@ -156,10 +441,16 @@ SQLRETURN duckdb::SingleExecuteStmt(OdbcHandleStmt *hstmt) {
 }
 
 SQLRETURN duckdb::FetchStmtResult(OdbcHandleStmt *hstmt, SQLSMALLINT fetch_orientation, SQLLEN fetch_offset) {
+	if (hstmt->pending) {
+		return SetDiagnosticRecord(hstmt, SQL_ERROR, "SQLFetch", "The asynchronous execution is still in progress",
+		                           SQLStateType::ST_HY010, hstmt->dbc->GetDataSourceName());
+	}
 	if (!hstmt->open) {
 		return SQL_NO_DATA;
 	}
-	SQLRETURN ret = hstmt->odbc_fetcher->Fetch(hstmt, fetch_orientation, fetch_offset);
+	// the query timeout is armed once per execution, fetching does not touch the watchdog
+	StatementCancelScope cancel_scope(*hstmt);
+	SQLRETURN ret = cancel_scope.Finish(hstmt->odbc_fetcher->Fetch(hstmt, fetch_orientation, fetch_offset));
 	if (!SQL_SUCCEEDED(ret)) {
 		return ret;
 	}
@@ -958,7 +1249,23 @@ SQLRETURN duckdb::GetDataStmtResult(OdbcHandleStmt *hstmt, SQLUSMALLINT col_or_p
 }
 
 SQLRETURN duckdb::ExecDirectStmt(OdbcHandleStmt *hstmt, const std::string &query) {
+	if (hstmt->pending) {
+		// the application polls an asynchronous execution, the query text is the one of the first call
+		return duckdb::BatchExecuteStmt(hstmt);
+	}
+	SQLRETURN async_ret = CheckNoAsyncExecution(hstmt, "SQLExecDirect");
+	if (async_ret != SQL_SUCCESS) {
+		return async_ret;
+	}
 	bool success_with_info = false;
+	SQLRETURN spill_ret = hstmt->dbc->SpillStreamingResults(hstmt, hstmt);
+	if (spill_ret != SQL_SUCCESS) {
+		return spill_ret;
+	}
+	SQLRETURN flush_ret = hstmt->dbc->FlushInsertBatch(hstmt);
+	if (flush_ret != SQL_SUCCESS) {
+		return flush_ret;
+	}
 	PrepareQuery(hstmt);
 
 	// Extract the statements from the query
@@ -971,8 +1278,9 @@ SQLRETURN duckdb::ExecDirectStmt(OdbcHandleStmt *hstmt, const std::string &query
 	}
 
 	SQLRETURN ret = SQL_SUCCESS;
-	for (auto &statement : statements) {
-		hstmt->stmt = hstmt->dbc->conn->Prepare(std::move(statement));
+	auto async_enable = hstmt->async_enable;
+	for (idx_t i = 0; i < statements.size(); i++) {
+		hstmt->stmt = hstmt->dbc->conn->Prepare(std::move(statements[i]));
 		ret = FinalizeStmt(hstmt);
 		if (!hstmt->stmt->success || !SQL_SUCCEEDED(ret)) {
 			return ret;
@@ -980,7 +1288,13 @@ SQLRETURN duckdb::ExecDirectStmt(OdbcHandleStmt *hstmt, const std::string &query
 			success_with_info = true;
 		}
 
+		// only the last statement, the one whose result is returned, is executed asynchronously
+		hstmt->async_enable = i + 1 == statements.size() ? async_enable : SQL_ASYNC_ENABLE_OFF;
 		ret = duckdb::BatchExecuteStmt(hstmt);
+		hstmt->async_enable = async_enable;
+		if (ret == SQL_STILL_EXECUTING) {
+			return ret;
+		}
 		if (!SQL_SUCCEEDED(ret)) {
 			return ret;
 		} else if (ret == SQL_SUCCESS_WITH_INFO) {
@@ -1004,6 +1318,8 @@ SQLRETURN duckdb::BindParameterStmt(OdbcHandleStmt *hstmt, SQLUSMALLINT paramete
 		                           SQLStateType::ST_07009, hstmt->dbc->GetDataSourceName());
 	}
 	idx_t param_idx = parameter_number - 1;
+	// the result columns described for the previous parameter types may change
+	hstmt->ird_param_types_valid = false;
 
 	//! New descriptor
 	auto ipd_record = hstmt->param_desc->ipd->GetDescRecord(param_idx);
@@ -1,6 +1,7 @@
 
 #include "widechar.hpp"
 
+#include <cstring>
 #include <limits>
 
 #define UTF_CPP_CPLUSPLUS 199711L
@@ -42,6 +43,102 @@ std::vector<SQLCHAR> utf16_to_utf8_lenient(const SQLWCHAR *in_buf, size_t in_buf
 	return res;
 }
 
+//! Writes the UTF-8 encoding of the code point starting at in_buf[idx] and advances idx past it.
+//! Lone and unpaired surrogates are written as the replacement character.
+static inline char *utf16_encode_code_point(const SQLWCHAR *in_buf, size_t &idx, size_t in_buf_len, char *out) {
+	uint32_t cp = utf8::internal::mask16(in_buf[idx++]);
+	if (cp < 0x80) {
+		*out++ = static_cast<char>(cp);
+		return out;
+	}
+	if (cp < 0x800) {
+		*out++ = static_cast<char>(0xc0 | (cp >> 6));
+		*out++ = static_cast<char>(0x80 | (cp & 0x3f));
+		return out;
+	}
+	if (utf8::internal::is_lead_surrogate(cp)) {
+		// with NTS input the terminator is not a trail surrogate, so the pair check cannot read past it
+		uint32_t trail = idx < in_buf_len ? utf8::internal::mask16(in_buf[idx]) : 0;
+		if (utf8::internal::is_trail_surrogate(trail)) {
+			idx++;
+			cp = 0x10000 + ((cp - 0xd800) << 10) + (trail - 0xdc00);
+			*out++ = static_cast<char>(0xf0 | (cp >> 18));
+			*out++ = static_cast<char>(0x80 | ((cp >> 12) & 0x3f));
+			*out++ = static_cast<char>(0x80 | ((cp >> 6) & 0x3f));
+			*out++ = static_cast<char>(0x80 | (cp & 0x3f));
+			return out;
+		}
+		cp = invalid_char_replacement;
+	} else if (utf8::internal::is_trail_surrogate(cp)) {
+		cp = invalid_char_replacement;
+	}
+	*out++ = static_cast<char>(0xe0 | (cp >> 12));
+	*out++ = static_cast<char>(0x80 | ((cp >> 6) & 0x3f));
+	*out++ = static_cast<char>(0x80 | (cp & 0x3f));
+	return out;
+}
+
+size_t utf16_to_utf8(const SQLWCHAR *in_buf, SQLLEN in_buf_len, std::string &out) {
+	out.clear();
+	if (in_buf == nullptr || (in_buf_len != SQL_NTS && in_buf_len <= 0)) {
+		return 0;
+	}
+
+	if (in_buf_len == SQL_NTS) {
+		// the length is unknown, grow the output while scanning for the terminator
+		out.resize(64);
+		size_t pos = 0;
+		size_t idx = 0;
+		while (true) {
+			if (out.size() - pos < 4) {
+				out.resize(out.size() * 2);
+			}
+			auto cp = utf8::internal::mask16(in_buf[idx]);
+			if (cp == 0) {
+				break;
+			}
+			if (cp < 0x80) {
+				out[pos++] = static_cast<char>(cp);
+				idx++;
+				continue;
+			}
+			auto end = utf16_encode_code_point(in_buf, idx, std::numeric_limits<size_t>::max(), &out[pos]);
+			pos = static_cast<size_t>(end - out.data());
+		}
+		out.resize(pos);
+		return idx;
+	}
+
+	// every code unit takes at most 3 bytes, a surrogate pair takes 4 bytes for 2 code units
+	auto len = static_cast<size_t>(in_buf_len);
+	out.resize(len * utf8_byte_len_coef);
+	char *start = &out[0];
+	char *dst = start;
+	size_t idx = 0;
+	while (idx < len) {
+		// ASCII fast path, checks four code units at once
+		while (sizeof(SQLWCHAR) == sizeof(uint16_t) && idx + 4 <= len) {
+			uint64_t block;
+			std::memcpy(&block, in_buf + idx, sizeof(block));
+			if (block & 0xff80ff80ff80ff80ULL) {
+				break;
+			}
+			dst[0] = static_cast<char>(in_buf[idx]);
+			dst[1] = static_cast<char>(in_buf[idx + 1]);
+			dst[2] = static_cast<char>(in_buf[idx + 2]);
+			dst[3] = static_cast<char>(in_buf[idx + 3]);
+			dst += 4;
+			idx += 4;
+		}
+		if (idx == len) {
+			break;
+		}
+		dst = utf16_encode_code_point(in_buf, idx, len, dst);
+	}
+	out.resize(static_cast<size_t>(dst - start));
+	return len;
+}
+
 std::vector<SQLWCHAR> utf8_to_utf16_lenient(const SQLCHAR *in_buf, size_t in_buf_len,
                                             const SQLCHAR **first_invalid_char) {
 	std::vector<SQLWCHAR> res;
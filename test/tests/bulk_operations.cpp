@@ -0,0 +1,146 @@
+#include "odbc_test_common.h"
+
+using namespace odbc_test;
+
+TEST_CASE("Test SQLBulkOperations with SQL_ADD", "[odbc]") {
+	SQLHANDLE env;
+	SQLHANDLE dbc;
+
+	HSTMT hstmt = SQL_NULL_HSTMT;
+
+	// Connect to the database using SQLConnect
+	CONNECT_TO_DATABASE(env, dbc);
+
+	// Allocate a statement handle
+	EXECUTE_AND_CHECK("SQLAllocHandle (HSTMT)", hstmt, SQLAllocHandle, SQL_HANDLE_STMT, dbc, &hstmt);
+	EXEC_SQL(hstmt, "CREATE TABLE bulk_add (id INTEGER, name VARCHAR, weight DOUBLE DEFAULT 1.5)");
+
+	// The cursor attributes advertise SQL_ADD
+	SQLUINTEGER cursor_attrs = 0;
+	EXECUTE_AND_CHECK("SQLGetInfo (SQL_STATIC_CURSOR_ATTRIBUTES1)", dbc, SQLGetInfo, dbc,
+	                  SQL_STATIC_CURSOR_ATTRIBUTES1, &cursor_attrs, sizeof(cursor_attrs), nullptr);
+	REQUIRE((cursor_attrs & SQL_CA1_BULK_ADD) != 0);
+
+	const SQLULEN row_array_size = 3;
+	EXECUTE_AND_CHECK("SQLSetStmtAttr (SQL_ATTR_ROW_ARRAY_SIZE)", hstmt, SQLSetStmtAttr, hstmt,
+	                  SQL_ATTR_ROW_ARRAY_SIZE, reinterpret_cast<SQLPOINTER>(row_array_size), 0);
+	SQLUSMALLINT row_status[row_array_size];
+	EXECUTE_AND_CHECK("SQLSetStmtAttr (SQL_ATTR_ROW_STATUS_PTR)", hstmt, SQLSetStmtAttr, hstmt,
+	                  SQL_ATTR_ROW_STATUS_PTR, row_status, 0);
+
+	EXECUTE_AND_CHECK("SQLExecDirect", hstmt, SQLExecDirect, hstmt,
+	                  ConvertToSQLCHAR("SELECT id, name FROM bulk_add"), SQL_NTS);
+
+	// Bind the rowset column-wise, the 'weight' column is not part of the cursor and gets its default
+	int32_t ids[row_array_size] = {1, 2, 3};
+	SQLLEN id_inds[row_array_size] = {0, 0, 0};
+	char names[row_array_size][16] = {"one", "two", ""};
+	SQLLEN name_inds[row_array_size] = {SQL_NTS, 3, SQL_NULL_DATA};
+	EXECUTE_AND_CHECK("SQLBindCol", hstmt, SQLBindCol, hstmt, 1, SQL_C_SLONG, ids, sizeof(ids[0]), id_inds);
+	EXECUTE_AND_CHECK("SQLBindCol", hstmt, SQLBindCol, hstmt, 2, SQL_C_CHAR, names, sizeof(names[0]), name_inds);
+
+	EXECUTE_AND_CHECK("SQLBulkOperations (SQL_ADD)", hstmt, SQLBulkOperations, hstmt, SQL_ADD);
+	for (SQLULEN i = 0; i < row_array_size; i++) {
+		REQUIRE(row_status[i] == SQL_ROW_ADDED);
+	}
+
+	EXECUTE_AND_CHECK("SQLFreeStmt (SQL_CLOSE)", hstmt, SQLFreeStmt, hstmt, SQL_CLOSE);
+	EXECUTE_AND_CHECK("SQLFreeStmt (SQL_UNBIND)", hstmt, SQLFreeStmt, hstmt, SQL_UNBIND);
+	EXECUTE_AND_CHECK("SQLSetStmtAttr (SQL_ATTR_ROW_ARRAY_SIZE)", hstmt, SQLSetStmtAttr, hstmt,
+	                  SQL_ATTR_ROW_ARRAY_SIZE, reinterpret_cast<SQLPOINTER>(1), 0);
+	EXECUTE_AND_CHECK("SQLSetStmtAttr (SQL_ATTR_ROW_STATUS_PTR)", hstmt, SQLSetStmtAttr, hstmt,
+	                  SQL_ATTR_ROW_STATUS_PTR, nullptr, 0);
+
+	// Check the inserted rows
+	EXECUTE_AND_CHECK("SQLExecDirect", hstmt, SQLExecDirect, hstmt,
+	                  ConvertToSQLCHAR("SELECT COUNT(*), SUM(id), STRING_AGG(name, ',' ORDER BY id), COUNT(name), "
+	                                   "MIN(weight) FROM bulk_add"),
+	                  SQL_NTS);
+	EXECUTE_AND_CHECK("SQLFetch", hstmt, SQLFetch, hstmt);
+	DATA_CHECK(hstmt, 1, "3");
+	DATA_CHECK(hstmt, 2, "6");
+	DATA_CHECK(hstmt, 3, "one,two");
+	DATA_CHECK(hstmt, 4, "2");
+	DATA_CHECK(hstmt, 5, "1.5");
+	EXECUTE_AND_CHECK("SQLFreeStmt (SQL_CLOSE)", hstmt, SQLFreeStmt, hstmt, SQL_CLOSE);
+
+	// A cursor that is not over the columns of a single table cannot add rows
+	EXECUTE_AND_CHECK("SQLExecDirect", hstmt, SQLExecDirect, hstmt,
+	                  ConvertToSQLCHAR("SELECT COUNT(*) FROM bulk_add"), SQL_NTS);
+	int64_t count = 0;
+	EXECUTE_AND_CHECK("SQLBindCol", hstmt, SQLBindCol, hstmt, 1, SQL_C_SBIGINT, &count, sizeof(count), nullptr);
+	REQUIRE(SQLBulkOperations(hstmt, SQL_ADD) == SQL_ERROR);
+	std::string state;
+	std::string message;
+	ACCESS_DIAGNOSTIC(state, message, hstmt, SQL_HANDLE_STMT);
+	REQUIRE(state == "HY000");
+
+	// Only SQL_ADD is supported
+	REQUIRE(SQLBulkOperations(hstmt, SQL_UPDATE_BY_BOOKMARK) == SQL_ERROR);
+	ACCESS_DIAGNOSTIC(state, message, hstmt, SQL_HANDLE_STMT);
+	REQUIRE(state == "HYC00");
+
+	// Free the statement handle
+	EXECUTE_AND_CHECK("SQLFreeStmt (HSTMT)", hstmt, SQLFreeStmt, hstmt, SQL_CLOSE);
+	EXECUTE_AND_CHECK("SQLFreeHandle (HSTMT)", hstmt, SQLFreeHandle, SQL_HANDLE_STMT, hstmt);
+
+	DISCONNECT_FROM_DATABASE(env, dbc);
+}
+
+TEST_CASE("Test SQLBulkOperations with SQL_COLUMN_IGNORE", "[odbc]") {
+	SQLHANDLE env;
+	SQLHANDLE dbc;
+
+	HSTMT hstmt = SQL_NULL_HSTMT;
+
+	// Connect to the database using SQLConnect
+	CONNECT_TO_DATABASE(env, dbc);
+
+	// Allocate a statement handle
+	EXECUTE_AND_CHECK("SQLAllocHandle (HSTMT)", hstmt, SQLAllocHandle, SQL_HANDLE_STMT, dbc, &hstmt);
+	EXEC_SQL(hstmt, "CREATE TABLE bulk_ignore (id INTEGER DEFAULT 42, weight DOUBLE DEFAULT 1.5)");
+
+	const SQLULEN row_array_size = 3;
+	EXECUTE_AND_CHECK("SQLSetStmtAttr (SQL_ATTR_ROW_ARRAY_SIZE)", hstmt, SQLSetStmtAttr, hstmt,
+	                  SQL_ATTR_ROW_ARRAY_SIZE, reinterpret_cast<SQLPOINTER>(row_array_size), 0);
+	SQLUSMALLINT row_status[row_array_size];
+	EXECUTE_AND_CHECK("SQLSetStmtAttr (SQL_ATTR_ROW_STATUS_PTR)", hstmt, SQLSetStmtAttr, hstmt,
+	                  SQL_ATTR_ROW_STATUS_PTR, row_status, 0);
+
+	EXECUTE_AND_CHECK("SQLExecDirect", hstmt, SQLExecDirect, hstmt,
+	                  ConvertToSQLCHAR("SELECT id, weight FROM bulk_ignore"), SQL_NTS);
+
+	// An ignored column gets its default value, not NULL. The last row ignores every column.
+	int32_t ids[row_array_size] = {1, 2, 0};
+	SQLLEN id_inds[row_array_size] = {0, 0, SQL_COLUMN_IGNORE};
+	double weights[row_array_size] = {2.5, 0, 0};
+	SQLLEN weight_inds[row_array_size] = {0, SQL_COLUMN_IGNORE, SQL_COLUMN_IGNORE};
+	EXECUTE_AND_CHECK("SQLBindCol", hstmt, SQLBindCol, hstmt, 1, SQL_C_SLONG, ids, sizeof(ids[0]), id_inds);
+	EXECUTE_AND_CHECK("SQLBindCol", hstmt, SQLBindCol, hstmt, 2, SQL_C_DOUBLE, weights, sizeof(weights[0]),
+	                  weight_inds);
+
+	EXECUTE_AND_CHECK("SQLBulkOperations (SQL_ADD)", hstmt, SQLBulkOperations, hstmt, SQL_ADD);
+	for (SQLULEN i = 0; i < row_array_size; i++) {
+		REQUIRE(row_status[i] == SQL_ROW_ADDED);
+	}
+
+	EXECUTE_AND_CHECK("SQLFreeStmt (SQL_CLOSE)", hstmt, SQLFreeStmt, hstmt, SQL_CLOSE);
+	EXECUTE_AND_CHECK("SQLFreeStmt (SQL_UNBIND)", hstmt, SQLFreeStmt, hstmt, SQL_UNBIND);
+	EXECUTE_AND_CHECK("SQLSetStmtAttr (SQL_ATTR_ROW_ARRAY_SIZE)", hstmt, SQLSetStmtAttr, hstmt,
+	                  SQL_ATTR_ROW_ARRAY_SIZE, reinterpret_cast<SQLPOINTER>(1), 0);
+	EXECUTE_AND_CHECK("SQLSetStmtAttr (SQL_ATTR_ROW_STATUS_PTR)", hstmt, SQLSetStmtAttr, hstmt,
+	                  SQL_ATTR_ROW_STATUS_PTR, nullptr, 0);
+
+	// Check the inserted rows
+	EXECUTE_AND_CHECK("SQLExecDirect", hstmt, SQLExecDirect, hstmt,
+	                  ConvertToSQLCHAR("SELECT STRING_AGG(id || ':' || weight, ',' ORDER BY id) FROM bulk_ignore"),
+	                  SQL_NTS);
+	EXECUTE_AND_CHECK("SQLFetch", hstmt, SQLFetch, hstmt);
+	DATA_CHECK(hstmt, 1, "1:2.5,2:1.5,42:1.5");
+
+	// Free the statement handle
+	EXECUTE_AND_CHECK("SQLFreeStmt (HSTMT)", hstmt, SQLFreeStmt, hstmt, SQL_CLOSE);
+	EXECUTE_AND_CHECK("SQLFreeHandle (HSTMT)", hstmt, SQLFreeHandle, SQL_HANDLE_STMT, hstmt);
+
+	DISCONNECT_FROM_DATABASE(env, dbc);
+}
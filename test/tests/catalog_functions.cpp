@@ -10,10 +10,11 @@ using namespace odbc_test;
  * SQLTables
  * SQLColumns
  * SQLGetInfo
+ * SQLPrimaryKeys
+ * SQLForeignKeys
+ * SQLStatistics
  *
  * TODO: Test the following catalog functions:
- * - SQLPrimaryKeys
- * - SQLForeignKeys
  * - SQLProcedureColumns
  * - SQLTablePrivileges
  * - SQLColumnPrivileges
@@ -108,6 +109,12 @@ void TestGetTypeInfo(HSTMT &hstmt, std::map<SQLSMALLINT, SQLULEN> &types_map) {
 
 	// unbind column
 	EXECUTE_AND_CHECK("SQLBindCol", hstmt, SQLBindCol, hstmt, 2, SQL_INTEGER, nullptr, 0, nullptr);
+
+	// An unsupported data type gives an empty result set with the same columns
+	EXECUTE_AND_CHECK("SQLGetTypeInfo", hstmt, SQLGetTypeInfo, hstmt, SQL_GUID);
+	EXECUTE_AND_CHECK("SQLNumResultCols", hstmt, SQLNumResultCols, hstmt, &col_count);
+	REQUIRE(col_count == 19);
+	REQUIRE(SQLFetch(hstmt) == SQL_NO_DATA);
 }
 
 static void TestSQLTables(HSTMT &hstmt, std::map<SQLSMALLINT, SQLULEN> &types_map) {
@@ -612,3 +619,354 @@ TEST_CASE("Test SQLColumns DATA_TYPE and SQL_DATA_TYPE and compare to SQLDescrib
 	// Disconnect from the database
 	DISCONNECT_FROM_DATABASE(env, dbc);
 }
+
+//! Returns the COLUMN_NAME of the rows returned by SQLColumns
+static std::vector<std::string> FetchColumnNames(HSTMT hstmt, const char *schema, const char *table,
+                                                 const char *column) {
+	EXECUTE_AND_CHECK("SQLColumns", hstmt, SQLColumns, hstmt, nullptr, 0, ConvertToSQLCHAR(schema), SQL_NTS,
+	                  ConvertToSQLCHAR(table), SQL_NTS, ConvertToSQLCHAR(column), SQL_NTS);
+	std::vector<std::string> columns;
+	while (SQLFetch(hstmt) != SQL_NO_DATA) {
+		SQLCHAR column_name[256];
+		EXECUTE_AND_CHECK("SQLGetData", hstmt, SQLGetData, hstmt, 4, SQL_C_CHAR, column_name, sizeof(column_name),
+		                  nullptr);
+		columns.push_back(ConvertToString(column_name));
+	}
+	EXECUTE_AND_CHECK("SQLFreeStmt (SQL_CLOSE)", hstmt, SQLFreeStmt, hstmt, SQL_CLOSE);
+	return columns;
+}
+
+TEST_CASE("Test SQLColumns and SQLTables name arguments", "[odbc]") {
+	SQLHANDLE env;
+	SQLHANDLE dbc;
+
+	HSTMT hstmt = SQL_NULL_HSTMT;
+
+	CONNECT_TO_DATABASE(env, dbc);
+	EXECUTE_AND_CHECK("SQLAllocHandle (HSTMT)", hstmt, SQLAllocHandle, SQL_HANDLE_STMT, dbc, &hstmt);
+
+	EXEC_SQL(hstmt, "CREATE TABLE name_t1 (a INTEGER NOT NULL, b_c VARCHAR DEFAULT 'x', bxc DECIMAL(10, 2))");
+	EXEC_SQL(hstmt, "CREATE TABLE nameXt1 (z INTEGER)");
+	EXEC_SQL(hstmt, "CREATE VIEW name_v (v1, v2) AS SELECT a, bxc FROM name_t1");
+
+	// A name without wildcards is looked up, an escaped underscore is not a wildcard
+	REQUIRE(FetchColumnNames(hstmt, "main", "name\\_t1", "%") == std::vector<std::string> {"a", "b_c", "bxc"});
+	REQUIRE(FetchColumnNames(hstmt, "main", "name\\_t1", "b\\_c") == std::vector<std::string> {"b_c"});
+	REQUIRE(FetchColumnNames(hstmt, "main", "name\\_t1", "b_c") == std::vector<std::string> {"b_c", "bxc"});
+	REQUIRE(FetchColumnNames(hstmt, "main", "name\\_t1", "B_C").empty());
+	REQUIRE(FetchColumnNames(hstmt, "main", "name_v", "") == std::vector<std::string> {"v1", "v2"});
+	// The rows are ordered by table name, then by ordinal position
+	REQUIRE(FetchColumnNames(hstmt, "", "name_t1", "%") == std::vector<std::string> {"z", "a", "b_c", "bxc"});
+	REQUIRE(FetchColumnNames(hstmt, "missing", "name%", "").empty());
+
+	// Nullability, default and precision come from the catalog entry
+	EXECUTE_AND_CHECK("SQLColumns", hstmt, SQLColumns, hstmt, nullptr, 0, ConvertToSQLCHAR("main"), SQL_NTS,
+	                  ConvertToSQLCHAR("name\\_t1"), SQL_NTS, nullptr, 0);
+	EXECUTE_AND_CHECK("SQLFetch", hstmt, SQLFetch, hstmt);
+	DATA_CHECK(hstmt, 7, "32");
+	DATA_CHECK(hstmt, 11, std::to_string(SQL_NO_NULLS));
+	DATA_CHECK(hstmt, 18, "NO");
+	EXECUTE_AND_CHECK("SQLFetch", hstmt, SQLFetch, hstmt);
+	DATA_CHECK(hstmt, 13, "'x'");
+	DATA_CHECK(hstmt, 18, "YES");
+	EXECUTE_AND_CHECK("SQLFetch", hstmt, SQLFetch, hstmt);
+	DATA_CHECK(hstmt, 6, "NUMERIC");
+	DATA_CHECK(hstmt, 7, "10");
+	DATA_CHECK(hstmt, 9, "2");
+	DATA_CHECK(hstmt, 17, "3");
+	REQUIRE(SQLFetch(hstmt) == SQL_NO_DATA);
+
+	// The result of a catalog function cannot be executed again
+	REQUIRE(SQLExecute(hstmt) == SQL_ERROR);
+	std::string state, message;
+	ACCESS_DIAGNOSTIC(state, message, hstmt, SQL_HANDLE_STMT);
+	REQUIRE(state == "HY010");
+	EXECUTE_AND_CHECK("SQLFreeStmt (SQL_CLOSE)", hstmt, SQLFreeStmt, hstmt, SQL_CLOSE);
+
+	// The table type list is comma separated, quoted or not, and may name types DuckDB does not have
+	EXECUTE_AND_CHECK("SQLTables", hstmt, SQLTables, hstmt, nullptr, 0, ConvertToSQLCHAR("main"), SQL_NTS,
+	                  ConvertToSQLCHAR("name%"), SQL_NTS, ConvertToSQLCHAR(" 'SYSTEM TABLE' ,view, 'table'"), SQL_NTS);
+	for (auto table : {"nameXt1", "name_t1"}) {
+		EXECUTE_AND_CHECK("SQLFetch", hstmt, SQLFetch, hstmt);
+		DATA_CHECK(hstmt, 3, table);
+		DATA_CHECK(hstmt, 4, "TABLE");
+	}
+	EXECUTE_AND_CHECK("SQLFetch", hstmt, SQLFetch, hstmt);
+	DATA_CHECK(hstmt, 3, "name_v");
+	DATA_CHECK(hstmt, 4, "VIEW");
+	REQUIRE(SQLFetch(hstmt) == SQL_NO_DATA);
+	EXECUTE_AND_CHECK("SQLFreeStmt (SQL_CLOSE)", hstmt, SQLFreeStmt, hstmt, SQL_CLOSE);
+	EXECUTE_AND_CHECK("SQLTables", hstmt, SQLTables, hstmt, nullptr, 0, ConvertToSQLCHAR("main"), SQL_NTS,
+	                  ConvertToSQLCHAR("name%"), SQL_NTS, ConvertToSQLCHAR("SYSTEM TABLE"), SQL_NTS);
+	REQUIRE(SQLFetch(hstmt) == SQL_NO_DATA);
+	EXECUTE_AND_CHECK("SQLFreeStmt (SQL_CLOSE)", hstmt, SQLFreeStmt, hstmt, SQL_CLOSE);
+
+	// With SQL_ATTR_METADATA_ID the arguments are identifiers, unquoted ones are case insensitive
+	EXECUTE_AND_CHECK("SQLSetConnectAttr (SQL_ATTR_METADATA_ID)", dbc, SQLSetConnectAttr, dbc, SQL_ATTR_METADATA_ID,
+	                  ConvertToSQLPOINTER(SQL_TRUE), SQL_IS_INTEGER);
+	REQUIRE(FetchColumnNames(hstmt, "main", "NAME_T1", "B_C") == std::vector<std::string> {"b_c"});
+	REQUIRE(FetchColumnNames(hstmt, "main", "\"NAME_T1\"", "b_c").empty());
+	REQUIRE(FetchColumnNames(hstmt, "main", "\"name_t1\"", "\"b_c\"") == std::vector<std::string> {"b_c"});
+	EXECUTE_AND_CHECK("SQLTables", hstmt, SQLTables, hstmt, nullptr, 0, ConvertToSQLCHAR("MAIN"), SQL_NTS,
+	                  ConvertToSQLCHAR("name_v"), SQL_NTS, ConvertToSQLCHAR("'VIEW'"), SQL_NTS);
+	EXECUTE_AND_CHECK("SQLFetch", hstmt, SQLFetch, hstmt);
+	DATA_CHECK(hstmt, 3, "name_v");
+	DATA_CHECK(hstmt, 4, "VIEW");
+	REQUIRE(SQLFetch(hstmt) == SQL_NO_DATA);
+	EXECUTE_AND_CHECK("SQLFreeStmt (SQL_CLOSE)", hstmt, SQLFreeStmt, hstmt, SQL_CLOSE);
+
+	EXEC_SQL(hstmt, "DROP VIEW name_v");
+	EXEC_SQL(hstmt, "DROP TABLE name_t1");
+	EXEC_SQL(hstmt, "DROP TABLE nameXt1");
+
+	EXECUTE_AND_CHECK("SQLFreeHandle (HSTMT)", hstmt, SQLFreeHandle, SQL_HANDLE_STMT, hstmt);
+	DISCONNECT_FROM_DATABASE(env, dbc);
+}
+
+TEST_CASE("Test SQLPrimaryKeys, SQLForeignKeys and SQLStatistics", "[odbc]") {
+	SQLHANDLE env;
+	SQLHANDLE dbc;
+
+	HSTMT hstmt = SQL_NULL_HSTMT;
+
+	CONNECT_TO_DATABASE(env, dbc);
+	EXECUTE_AND_CHECK("SQLAllocHandle (HSTMT)", hstmt, SQLAllocHandle, SQL_HANDLE_STMT, dbc, &hstmt);
+
+	EXEC_SQL(hstmt, "CREATE TABLE key_parent (id INTEGER PRIMARY KEY, code VARCHAR UNIQUE, name VARCHAR)");
+	EXEC_SQL(hstmt, "CREATE TABLE key_child (id INTEGER, parent_id INTEGER REFERENCES key_parent (id), "
+	                "parent_code VARCHAR, FOREIGN KEY (parent_code) REFERENCES key_parent (code))");
+	EXEC_SQL(hstmt, "CREATE INDEX key_child_idx ON key_child (parent_id)");
+	EXEC_SQL(hstmt, "INSERT INTO key_parent VALUES (1, 'a', 'x'), (2, 'b', 'y')");
+
+	// SQLPrimaryKeys
+	EXECUTE_AND_CHECK("SQLPrimaryKeys", hstmt, SQLPrimaryKeys, hstmt, nullptr, 0, ConvertToSQLCHAR("main"), SQL_NTS,
+	                  ConvertToSQLCHAR("key_parent"), SQL_NTS);
+	EXECUTE_AND_CHECK("SQLFetch", hstmt, SQLFetch, hstmt);
+	DATA_CHECK(hstmt, 2, "main");
+	DATA_CHECK(hstmt, 3, "key_parent");
+	DATA_CHECK(hstmt, 4, "id");
+	DATA_CHECK(hstmt, 5, "1");
+	DATA_CHECK(hstmt, 6, "key_parent_id_pkey");
+	REQUIRE(SQLFetch(hstmt) == SQL_NO_DATA);
+	EXECUTE_AND_CHECK("SQLFreeStmt (SQL_CLOSE)", hstmt, SQLFreeStmt, hstmt, SQL_CLOSE);
+
+	// The arguments are not search patterns
+	EXECUTE_AND_CHECK("SQLPrimaryKeys", hstmt, SQLPrimaryKeys, hstmt, nullptr, 0, nullptr, 0,
+	                  ConvertToSQLCHAR("key%"), SQL_NTS);
+	REQUIRE(SQLFetch(hstmt) == SQL_NO_DATA);
+	EXECUTE_AND_CHECK("SQLFreeStmt (SQL_CLOSE)", hstmt, SQLFreeStmt, hstmt, SQL_CLOSE);
+	REQUIRE(SQLPrimaryKeys(hstmt, nullptr, 0, nullptr, 0, nullptr, 0) == SQL_ERROR);
+
+	// SQLForeignKeys by the referenced table and by the referencing table
+	for (int by_fk_table = 0; by_fk_table < 2; by_fk_table++) {
+		auto pk_table = by_fk_table ? nullptr : ConvertToSQLCHAR("key_parent");
+		auto fk_table = by_fk_table ? ConvertToSQLCHAR("key_child") : nullptr;
+		EXECUTE_AND_CHECK("SQLForeignKeys", hstmt, SQLForeignKeys, hstmt, nullptr, 0, nullptr, 0, pk_table, SQL_NTS,
+		                  nullptr, 0, nullptr, 0, fk_table, SQL_NTS);
+		std::vector<std::array<std::string, 4>> expected = {
+		    {"code", "parent_code", "key_child_parent_code_code_fkey", "key_parent_code_key"},
+		    {"id", "parent_id", "key_child_parent_id_id_fkey", "key_parent_id_pkey"}};
+		for (auto &row : expected) {
+			EXECUTE_AND_CHECK("SQLFetch", hstmt, SQLFetch, hstmt);
+			DATA_CHECK(hstmt, 3, "key_parent");
+			DATA_CHECK(hstmt, 4, row[0]);
+			DATA_CHECK(hstmt, 7, "key_child");
+			DATA_CHECK(hstmt, 8, row[1]);
+			DATA_CHECK(hstmt, 9, "1");
+			DATA_CHECK(hstmt, 10, std::to_string(SQL_NO_ACTION));
+			DATA_CHECK(hstmt, 12, row[2]);
+			DATA_CHECK(hstmt, 13, row[3]);
+		}
+		REQUIRE(SQLFetch(hstmt) == SQL_NO_DATA);
+		EXECUTE_AND_CHECK("SQLFreeStmt (SQL_CLOSE)", hstmt, SQLFreeStmt, hstmt, SQL_CLOSE);
+	}
+
+	// SQLStatistics reports the row count, then the unique indexes and the other indexes
+	EXECUTE_AND_CHECK("SQLStatistics", hstmt, SQLStatistics, hstmt, nullptr, 0, nullptr, 0,
+	                  ConvertToSQLCHAR("key_parent"), SQL_NTS, SQL_INDEX_ALL, SQL_QUICK);
+	EXECUTE_AND_CHECK("SQLFetch", hstmt, SQLFetch, hstmt);
+	DATA_CHECK(hstmt, 7, std::to_string(SQL_TABLE_STAT));
+	DATA_CHECK(hstmt, 11, "2");
+	for (auto &index : std::vector<std::array<std::string, 2>> {{"key_parent_code_key", "code"},
+	                                                             {"key_parent_id_pkey", "id"}}) {
+		EXECUTE_AND_CHECK("SQLFetch", hstmt, SQLFetch, hstmt);
+		DATA_CHECK(hstmt, 4, "0");
+		DATA_CHECK(hstmt, 6, index[0]);
+		DATA_CHECK(hstmt, 7, std::to_string(SQL_INDEX_OTHER));
+		DATA_CHECK(hstmt, 8, "1");
+		DATA_CHECK(hstmt, 9, index[1]);
+		DATA_CHECK(hstmt, 11, "2");
+	}
+	REQUIRE(SQLFetch(hstmt) == SQL_NO_DATA);
+	EXECUTE_AND_CHECK("SQLFreeStmt (SQL_CLOSE)", hstmt, SQLFreeStmt, hstmt, SQL_CLOSE);
+
+	EXECUTE_AND_CHECK("SQLStatistics", hstmt, SQLStatistics, hstmt, nullptr, 0, nullptr, 0,
+	                  ConvertToSQLCHAR("key_child"), SQL_NTS, SQL_INDEX_ALL, SQL_QUICK);
+	EXECUTE_AND_CHECK("SQLFetch", hstmt, SQLFetch, hstmt);
+	DATA_CHECK(hstmt, 11, "0");
+	EXECUTE_AND_CHECK("SQLFetch", hstmt, SQLFetch, hstmt);
+	DATA_CHECK(hstmt, 4, "1");
+	DATA_CHECK(hstmt, 6, "key_child_idx");
+	DATA_CHECK(hstmt, 9, "parent_id");
+	REQUIRE(SQLFetch(hstmt) == SQL_NO_DATA);
+	EXECUTE_AND_CHECK("SQLFreeStmt (SQL_CLOSE)", hstmt, SQLFreeStmt, hstmt, SQL_CLOSE);
+
+	// Only the table statistics row is left when non-unique indexes are excluded
+	EXECUTE_AND_CHECK("SQLStatistics", hstmt, SQLStatistics, hstmt, nullptr, 0, nullptr, 0,
+	                  ConvertToSQLCHAR("key_child"), SQL_NTS, SQL_INDEX_UNIQUE, SQL_QUICK);
+	EXECUTE_AND_CHECK("SQLFetch", hstmt, SQLFetch, hstmt);
+	REQUIRE(SQLFetch(hstmt) == SQL_NO_DATA);
+	EXECUTE_AND_CHECK("SQLFreeStmt (SQL_CLOSE)", hstmt, SQLFreeStmt, hstmt, SQL_CLOSE);
+
+	REQUIRE(SQLStatistics(hstmt, nullptr, 0, nullptr, 0, ConvertToSQLCHAR("key_child"), SQL_NTS, 42, SQL_QUICK) ==
+	        SQL_ERROR);
+	std::string state, message;
+	ACCESS_DIAGNOSTIC(state, message, hstmt, SQL_HANDLE_STMT);
+	REQUIRE(state == "HY100");
+
+	// The catalog does not change with the rows, the row count of a call after DML is not the previous one
+	EXEC_SQL(hstmt, "INSERT INTO key_parent VALUES (3, 'c', 'z')");
+	for (SQLUSMALLINT accuracy : {SQL_QUICK, SQL_ENSURE}) {
+		EXECUTE_AND_CHECK("SQLStatistics", hstmt, SQLStatistics, hstmt, nullptr, 0, nullptr, 0,
+		                  ConvertToSQLCHAR("key_parent"), SQL_NTS, SQL_INDEX_ALL, accuracy);
+		EXECUTE_AND_CHECK("SQLFetch", hstmt, SQLFetch, hstmt);
+		DATA_CHECK(hstmt, 11, "3");
+		EXECUTE_AND_CHECK("SQLFetch", hstmt, SQLFetch, hstmt);
+		DATA_CHECK(hstmt, 6, "key_parent_code_key");
+		DATA_CHECK(hstmt, 11, "3");
+		EXECUTE_AND_CHECK("SQLFreeStmt (SQL_CLOSE)", hstmt, SQLFreeStmt, hstmt, SQL_CLOSE);
+	}
+
+	EXEC_SQL(hstmt, "DROP TABLE key_child");
+	EXEC_SQL(hstmt, "DROP TABLE key_parent");
+
+	EXECUTE_AND_CHECK("SQLFreeHandle (HSTMT)", hstmt, SQLFreeHandle, SQL_HANDLE_STMT, hstmt);
+	DISCONNECT_FROM_DATABASE(env, dbc);
+}
+
+TEST_CASE("Test SQLStatistics with SQL_ENSURE", "[odbc]") {
+	SQLHANDLE env;
+	SQLHANDLE dbc;
+
+	HSTMT hstmt = SQL_NULL_HSTMT;
+
+	CONNECT_TO_DATABASE(env, dbc);
+	EXECUTE_AND_CHECK("SQLAllocHandle (HSTMT)", hstmt, SQLAllocHandle, SQL_HANDLE_STMT, dbc, &hstmt);
+
+	EXEC_SQL(hstmt, "CREATE TABLE stat_rows (id INTEGER, grp INTEGER)");
+	EXEC_SQL(hstmt, "CREATE INDEX stat_rows_idx ON stat_rows (grp)");
+	EXEC_SQL(hstmt, "INSERT INTO stat_rows SELECT i, i % 4 FROM range(100) t(i)");
+
+	// Without deleted rows both accuracies report the row count
+	for (SQLUSMALLINT accuracy : {SQL_QUICK, SQL_ENSURE}) {
+		EXECUTE_AND_CHECK("SQLStatistics", hstmt, SQLStatistics, hstmt, nullptr, 0, nullptr, 0,
+		                  ConvertToSQLCHAR("stat_rows"), SQL_NTS, SQL_INDEX_ALL, accuracy);
+		EXECUTE_AND_CHECK("SQLFetch", hstmt, SQLFetch, hstmt);
+		DATA_CHECK(hstmt, 11, "100");
+		EXECUTE_AND_CHECK("SQLFreeStmt (SQL_CLOSE)", hstmt, SQLFreeStmt, hstmt, SQL_CLOSE);
+	}
+
+	// SQL_ENSURE does not count the deleted rows, the result is not served from a previous call
+	EXEC_SQL(hstmt, "DELETE FROM stat_rows WHERE id < 10");
+	EXECUTE_AND_CHECK("SQLStatistics", hstmt, SQLStatistics, hstmt, nullptr, 0, nullptr, 0,
+	                  ConvertToSQLCHAR("stat_rows"), SQL_NTS, SQL_INDEX_ALL, SQL_ENSURE);
+	EXECUTE_AND_CHECK("SQLFetch", hstmt, SQLFetch, hstmt);
+	DATA_CHECK(hstmt, 7, std::to_string(SQL_TABLE_STAT));
+	DATA_CHECK(hstmt, 11, "90");
+
+	// The cardinality of a non-unique index is the estimated number of distinct values of its column
+	EXECUTE_AND_CHECK("SQLFetch", hstmt, SQLFetch, hstmt);
+	DATA_CHECK(hstmt, 6, "stat_rows_idx");
+	SQLINTEGER cardinality = 0;
+	SQLLEN indicator = 0;
+	EXECUTE_AND_CHECK("SQLGetData", hstmt, SQLGetData, hstmt, 11, SQL_C_SLONG, &cardinality, sizeof(cardinality),
+	                  &indicator);
+	REQUIRE(indicator != SQL_NULL_DATA);
+	REQUIRE(cardinality > 0);
+	REQUIRE(cardinality <= 90);
+	REQUIRE(SQLFetch(hstmt) == SQL_NO_DATA);
+	EXECUTE_AND_CHECK("SQLFreeStmt (SQL_CLOSE)", hstmt, SQLFreeStmt, hstmt, SQL_CLOSE);
+
+	// Rows appended by the open transaction are counted
+	EXEC_SQL(hstmt, "BEGIN TRANSACTION");
+	EXEC_SQL(hstmt, "INSERT INTO stat_rows VALUES (100, 0), (101, 1)");
+	EXECUTE_AND_CHECK("SQLStatistics", hstmt, SQLStatistics, hstmt, nullptr, 0, nullptr, 0,
+	                  ConvertToSQLCHAR("stat_rows"), SQL_NTS, SQL_INDEX_UNIQUE, SQL_ENSURE);
+	EXECUTE_AND_CHECK("SQLFetch", hstmt, SQLFetch, hstmt);
+	DATA_CHECK(hstmt, 11, "92");
+	EXECUTE_AND_CHECK("SQLFreeStmt (SQL_CLOSE)", hstmt, SQLFreeStmt, hstmt, SQL_CLOSE);
+
+	// So are the rows the open transaction deleted, whether it appended them or not
+	EXEC_SQL(hstmt, "INSERT INTO stat_rows VALUES (102, 2)");
+	EXEC_SQL(hstmt, "DELETE FROM stat_rows WHERE id IN (10, 11, 101)");
+	EXECUTE_AND_CHECK("SQLStatistics", hstmt, SQLStatistics, hstmt, nullptr, 0, nullptr, 0,
+	                  ConvertToSQLCHAR("stat_rows"), SQL_NTS, SQL_INDEX_UNIQUE, SQL_ENSURE);
+	EXECUTE_AND_CHECK("SQLFetch", hstmt, SQLFetch, hstmt);
+	DATA_CHECK(hstmt, 11, "90");
+	EXECUTE_AND_CHECK("SQLFreeStmt (SQL_CLOSE)", hstmt, SQLFreeStmt, hstmt, SQL_CLOSE);
+	EXEC_SQL(hstmt, "ROLLBACK");
+
+	EXEC_SQL(hstmt, "DROP TABLE stat_rows");
+
+	EXECUTE_AND_CHECK("SQLFreeHandle (HSTMT)", hstmt, SQLFreeHandle, SQL_HANDLE_STMT, hstmt);
+	DISCONNECT_FROM_DATABASE(env, dbc);
+}
+
+TEST_CASE("Test SQLTables over attached catalogs with metadata_exclude_catalogs", "[odbc]") {
+	SQLHANDLE env;
+	SQLHANDLE dbc;
+
+	HSTMT hstmt = SQL_NULL_HSTMT;
+
+	DRIVER_CONNECT_TO_DATABASE(env, dbc, "DSN=duckdbmemory;metadata_exclude_catalogs=skipped_db, \"Quoted,Db\"");
+	EXECUTE_AND_CHECK("SQLAllocHandle (HSTMT)", hstmt, SQLAllocHandle, SQL_HANDLE_STMT, dbc, &hstmt);
+
+	for (std::string catalog : {"attached_b", "attached_a", "skipped_db", "\"Quoted,Db\""}) {
+		EXEC_SQL(hstmt, "ATTACH ':memory:' AS " + catalog);
+		EXEC_SQL(hstmt, "CREATE TABLE " + catalog + ".main.attached_t1 (i INTEGER)");
+		EXEC_SQL(hstmt, "CREATE VIEW " + catalog + ".main.attached_v1 AS SELECT 1 AS i");
+	}
+
+	// The catalogs are walked concurrently, the rows are ordered by type, catalog, schema and name
+	EXECUTE_AND_CHECK("SQLTables", hstmt, SQLTables, hstmt, ConvertToSQLCHAR("%"), SQL_NTS, ConvertToSQLCHAR("%"),
+	                  SQL_NTS, ConvertToSQLCHAR("attached_%"), SQL_NTS, nullptr, 0);
+	std::vector<std::array<std::string, 3>> expected {{"attached_a", "attached_t1", "TABLE"},
+	                                                  {"attached_b", "attached_t1", "TABLE"},
+	                                                  {"attached_a", "attached_v1", "VIEW"},
+	                                                  {"attached_b", "attached_v1", "VIEW"}};
+	for (auto &row : expected) {
+		EXECUTE_AND_CHECK("SQLFetch", hstmt, SQLFetch, hstmt);
+		DATA_CHECK(hstmt, 1, row[0]);
+		DATA_CHECK(hstmt, 3, row[1]);
+		DATA_CHECK(hstmt, 4, row[2]);
+	}
+	REQUIRE(SQLFetch(hstmt) == SQL_NO_DATA);
+	EXECUTE_AND_CHECK("SQLFreeStmt (SQL_CLOSE)", hstmt, SQLFreeStmt, hstmt, SQL_CLOSE);
+
+	// An excluded catalog is not listed, even when it is named
+	EXECUTE_AND_CHECK("SQLTables", hstmt, SQLTables, hstmt, ConvertToSQLCHAR("SKIPPED_DB"), SQL_NTS, nullptr, 0,
+	                  nullptr, 0, nullptr, 0);
+	REQUIRE(SQLFetch(hstmt) == SQL_NO_DATA);
+	EXECUTE_AND_CHECK("SQLFreeStmt (SQL_CLOSE)", hstmt, SQLFreeStmt, hstmt, SQL_CLOSE);
+	EXECUTE_AND_CHECK("SQLColumns", hstmt, SQLColumns, hstmt, nullptr, 0, nullptr, 0, ConvertToSQLCHAR("attached_t1"),
+	                  SQL_NTS, nullptr, 0);
+	for (int i = 0; i < 2; i++) {
+		EXECUTE_AND_CHECK("SQLFetch", hstmt, SQLFetch, hstmt);
+	}
+	REQUIRE(SQLFetch(hstmt) == SQL_NO_DATA);
+	EXECUTE_AND_CHECK("SQLFreeStmt (SQL_CLOSE)", hstmt, SQLFreeStmt, hstmt, SQL_CLOSE);
+
+	EXECUTE_AND_CHECK("SQLTables", hstmt, SQLTables, hstmt, ConvertToSQLCHAR(SQL_ALL_CATALOGS), SQL_NTS,
+	                  ConvertToSQLCHAR(""), SQL_NTS, ConvertToSQLCHAR(""), SQL_NTS, ConvertToSQLCHAR(""), SQL_NTS);
+	std::vector<std::string> catalogs;
+	while (SQLFetch(hstmt) != SQL_NO_DATA) {
+		SQLCHAR catalog[256];
+		EXECUTE_AND_CHECK("SQLGetData", hstmt, SQLGetData, hstmt, 1, SQL_C_CHAR, catalog, sizeof(catalog), nullptr);
+		catalogs.push_back(ConvertToString(catalog));
+	}
+	REQUIRE(catalogs == std::vector<std::string> {"attached_a", "attached_b", "memory"});
+	EXECUTE_AND_CHECK("SQLFreeStmt (SQL_CLOSE)", hstmt, SQLFreeStmt, hstmt, SQL_CLOSE);
+
+	EXECUTE_AND_CHECK("SQLFreeHandle (HSTMT)", hstmt, SQLFreeHandle, SQL_HANDLE_STMT, hstmt);
+	DISCONNECT_FROM_DATABASE(env, dbc);
+}
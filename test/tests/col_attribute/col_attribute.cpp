@@ -230,3 +230,49 @@ TEST_CASE("Test SQLColAttribute with unicode column name", "[odbc]") {
 	// Disconnect from the database
 	DISCONNECT_FROM_DATABASE(env, dbc);
 }
+
+TEST_CASE("Test SQLColAttribute for a wide result set", "[odbc]") {
+	SQLHANDLE env;
+	SQLHANDLE dbc;
+
+	HSTMT hstmt = SQL_NULL_HSTMT;
+
+	// Connect to the database using SQLConnect
+	CONNECT_TO_DATABASE(env, dbc);
+
+	// Allocate a statement handle
+	EXECUTE_AND_CHECK("SQLAllocHandle (HSTMT)", hstmt, SQLAllocHandle, SQL_HANDLE_STMT, dbc, &hstmt);
+
+	const int num_cols = 2000;
+	std::string query = "SELECT ";
+	for (int i = 1; i <= num_cols; i++) {
+		query += (i > 1 ? ", " : "") + std::to_string(i) + " AS a_rather_long_column_name_" + std::to_string(i);
+	}
+	EXECUTE_AND_CHECK("SQLPrepare", hstmt, SQLPrepare, hstmt, ConvertToSQLCHAR(query), SQL_NTS);
+
+	SQLSMALLINT col_count = 0;
+	EXECUTE_AND_CHECK("SQLNumResultCols", hstmt, SQLNumResultCols, hstmt, &col_count);
+	REQUIRE(col_count == num_cols);
+
+	// The label and the base column name are the name of the column
+	for (int i : {1, num_cols}) {
+		std::string expected = "a_rather_long_column_name_" + std::to_string(i);
+		for (SQLUSMALLINT field : {SQL_DESC_NAME, SQL_DESC_LABEL, SQL_DESC_BASE_COLUMN_NAME}) {
+			char buffer[64];
+			EXECUTE_AND_CHECK("SQLColAttribute", hstmt, SQLColAttribute, hstmt, i, field, buffer, sizeof(buffer),
+			                  nullptr, nullptr);
+			REQUIRE(std::string(buffer) == expected);
+		}
+		char catalog[64];
+		EXECUTE_AND_CHECK("SQLColAttribute", hstmt, SQLColAttribute, hstmt, i, SQL_DESC_CATALOG_NAME, catalog,
+		                  sizeof(catalog), nullptr, nullptr);
+		REQUIRE(std::string(catalog) == "system");
+	}
+
+	// Free the statement handle
+	EXECUTE_AND_CHECK("SQLFreeStmt (HSTMT)", hstmt, SQLFreeStmt, hstmt, SQL_CLOSE);
+	EXECUTE_AND_CHECK("SQLFreeHandle (HSTMT)", hstmt, SQLFreeHandle, SQL_HANDLE_STMT, hstmt);
+
+	// Disconnect from the database
+	DISCONNECT_FROM_DATABASE(env, dbc);
+}
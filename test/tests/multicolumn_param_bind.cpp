@@ -103,3 +103,125 @@ TEST_CASE("Test binding multiple columsn at once", "[odbc]") {
 
 	DISCONNECT_FROM_DATABASE(env, dbc);
 }
+
+// large enough for the parameter sets to be converted ahead on another thread while the previous set executes
+#define PIPELINED_INSERT_COUNT 100
+
+TEST_CASE("Test binding a large array of parameter sets", "[odbc]") {
+	SQLHANDLE env;
+	SQLHANDLE dbc;
+
+	HSTMT hstmt = SQL_NULL_HSTMT;
+
+	// Connect to the database using SQLConnect
+	CONNECT_TO_DATABASE(env, dbc);
+
+	// Allocate a statement handle
+	EXECUTE_AND_CHECK("SQLAllocHandle (HSTMT)", hstmt, SQLAllocHandle, SQL_HANDLE_STMT, dbc, &hstmt);
+
+	// Create a table
+	EXECUTE_AND_CHECK("SQLExecDirect (CREATE TABLE)", hstmt, SQLExecDirect, hstmt,
+	                  ConvertToSQLCHAR("CREATE TABLE test_tbl_array (Column1 VARCHAR(100))"), SQL_NTS);
+	EXECUTE_AND_CHECK("SQLFreeStmt (SQL_CLOSE)", hstmt, SQLFreeStmt, hstmt, SQL_CLOSE);
+
+	SQLUSMALLINT param_status[PIPELINED_INSERT_COUNT];
+	EXECUTE_AND_CHECK("SQLSetStmtAttr (SQL_ATTR_PARAM_STATUS_PTR)", hstmt, SQLSetStmtAttr, hstmt,
+	                  SQL_ATTR_PARAM_STATUS_PTR, param_status, 0);
+	SQLULEN params_processed = 0;
+	EXECUTE_AND_CHECK("SQLSetStmtAttr (SQL_ATTR_PARAMS_PROCESSED_PTR)", hstmt, SQLSetStmtAttr, hstmt,
+	                  SQL_ATTR_PARAMS_PROCESSED_PTR, &params_processed, 0);
+	EXECUTE_AND_CHECK("SQLSetStmtAttr (SQL_ATTR_PARAMSET_SIZE)", hstmt, SQLSetStmtAttr, hstmt, SQL_ATTR_PARAMSET_SIZE,
+	                  ConvertToSQLPOINTER(PIPELINED_INSERT_COUNT), 0);
+
+	char c1[PIPELINED_INSERT_COUNT][MAX_BUFFER_SIZE];
+	SQLLEN c1_ind[PIPELINED_INSERT_COUNT];
+	for (int i = 0; i < PIPELINED_INSERT_COUNT; i++) {
+		std::string value = "value " + std::to_string(i);
+		memcpy(c1[i], value.c_str(), value.length() + 1);
+		// the odd sets are null-terminated, their length is written back to the indicator
+		c1_ind[i] = i % 2 ? SQL_NTS : static_cast<SQLLEN>(value.length());
+	}
+	EXECUTE_AND_CHECK("SQLBindParameter", hstmt, SQLBindParameter, hstmt, 1, SQL_PARAM_INPUT, SQL_C_CHAR, SQL_VARCHAR,
+	                  MAX_BUFFER_SIZE - 1, 0, c1, MAX_BUFFER_SIZE, c1_ind);
+
+	// Execute the statement, all parameter sets must be processed in order
+	EXECUTE_AND_CHECK("SQLExecDirect (INSERT)", hstmt, SQLExecDirect, hstmt,
+	                  ConvertToSQLCHAR("INSERT INTO test_tbl_array VALUES (?)"), SQL_NTS);
+	REQUIRE(params_processed == PIPELINED_INSERT_COUNT);
+	for (int i = 0; i < PIPELINED_INSERT_COUNT; i++) {
+		REQUIRE(param_status[i] == SQL_PARAM_SUCCESS);
+		REQUIRE(c1_ind[i] == static_cast<SQLLEN>(("value " + std::to_string(i)).length()));
+	}
+
+	// Free and re-allocate the statement handle to reset the parameter array
+	EXECUTE_AND_CHECK("SQLFreeHandle (HSTMT)", hstmt, SQLFreeHandle, SQL_HANDLE_STMT, hstmt);
+	EXECUTE_AND_CHECK("SQLAllocHandle (HSTMT)", hstmt, SQLAllocHandle, SQL_HANDLE_STMT, dbc, &hstmt);
+
+	EXECUTE_AND_CHECK("SQLExecDirect (SELECT)", hstmt, SQLExecDirect, hstmt,
+	                  ConvertToSQLCHAR("SELECT COUNT(DISTINCT Column1), MIN(Column1), MAX(Column1) FROM test_tbl_array"),
+	                  SQL_NTS);
+	EXECUTE_AND_CHECK("SQLFetch", hstmt, SQLFetch, hstmt);
+	DATA_CHECK(hstmt, 1, std::to_string(PIPELINED_INSERT_COUNT));
+	DATA_CHECK(hstmt, 2, "value 0");
+	DATA_CHECK(hstmt, 3, "value 99");
+
+	// Free the statement handle
+	EXECUTE_AND_CHECK("SQLFreeStmt (HSTMT)", hstmt, SQLFreeStmt, hstmt, SQL_CLOSE);
+	EXECUTE_AND_CHECK("SQLFreeHandle (HSTMT)", hstmt, SQLFreeHandle, SQL_HANDLE_STMT, hstmt);
+
+	DISCONNECT_FROM_DATABASE(env, dbc);
+}
+
+TEST_CASE("Test a failing parameter set in the middle of an array", "[odbc]") {
+	SQLHANDLE env;
+	SQLHANDLE dbc;
+
+	HSTMT hstmt = SQL_NULL_HSTMT;
+
+	// Connect to the database using SQLConnect
+	CONNECT_TO_DATABASE(env, dbc);
+
+	// Allocate a statement handle
+	EXECUTE_AND_CHECK("SQLAllocHandle (HSTMT)", hstmt, SQLAllocHandle, SQL_HANDLE_STMT, dbc, &hstmt);
+
+	// Create a table with a primary key
+	EXECUTE_AND_CHECK("SQLExecDirect (CREATE TABLE)", hstmt, SQLExecDirect, hstmt,
+	                  ConvertToSQLCHAR("CREATE TABLE test_tbl_array_error (Column1 INTEGER PRIMARY KEY)"), SQL_NTS);
+	EXECUTE_AND_CHECK("SQLFreeStmt (SQL_CLOSE)", hstmt, SQLFreeStmt, hstmt, SQL_CLOSE);
+
+	SQLUSMALLINT param_status[PIPELINED_INSERT_COUNT];
+	EXECUTE_AND_CHECK("SQLSetStmtAttr (SQL_ATTR_PARAM_STATUS_PTR)", hstmt, SQLSetStmtAttr, hstmt,
+	                  SQL_ATTR_PARAM_STATUS_PTR, param_status, 0);
+	SQLULEN params_processed = 0;
+	EXECUTE_AND_CHECK("SQLSetStmtAttr (SQL_ATTR_PARAMS_PROCESSED_PTR)", hstmt, SQLSetStmtAttr, hstmt,
+	                  SQL_ATTR_PARAMS_PROCESSED_PTR, &params_processed, 0);
+	EXECUTE_AND_CHECK("SQLSetStmtAttr (SQL_ATTR_PARAMSET_SIZE)", hstmt, SQLSetStmtAttr, hstmt, SQL_ATTR_PARAMSET_SIZE,
+	                  ConvertToSQLPOINTER(PIPELINED_INSERT_COUNT), 0);
+
+	// the parameter set 10 repeats the key of the first one
+	char c1[PIPELINED_INSERT_COUNT][MAX_BUFFER_SIZE];
+	SQLLEN c1_ind[PIPELINED_INSERT_COUNT];
+	for (int i = 0; i < PIPELINED_INSERT_COUNT; i++) {
+		std::string value = std::to_string(i == 10 ? 0 : i);
+		memcpy(c1[i], value.c_str(), value.length());
+		c1_ind[i] = static_cast<SQLLEN>(value.length());
+	}
+	EXECUTE_AND_CHECK("SQLBindParameter", hstmt, SQLBindParameter, hstmt, 1, SQL_PARAM_INPUT, SQL_C_CHAR, SQL_VARCHAR,
+	                  MAX_BUFFER_SIZE - 1, 0, c1, MAX_BUFFER_SIZE, c1_ind);
+
+	REQUIRE(SQLExecDirect(hstmt, ConvertToSQLCHAR("INSERT INTO test_tbl_array_error VALUES (?)"), SQL_NTS) ==
+	        SQL_ERROR);
+	REQUIRE(params_processed == 11);
+	for (int i = 0; i < 10; i++) {
+		REQUIRE(param_status[i] == SQL_PARAM_SUCCESS);
+	}
+	REQUIRE(param_status[10] == SQL_PARAM_ERROR);
+	for (int i = 11; i < PIPELINED_INSERT_COUNT; i++) {
+		REQUIRE(param_status[i] == SQL_PARAM_UNUSED);
+	}
+
+	// Free the statement handle
+	EXECUTE_AND_CHECK("SQLFreeHandle (HSTMT)", hstmt, SQLFreeHandle, SQL_HANDLE_STMT, hstmt);
+
+	DISCONNECT_FROM_DATABASE(env, dbc);
+}
@@ -0,0 +1,93 @@
+#include "odbc_test_common.h"
+
+using namespace odbc_test;
+
+//! Runs long enough on any machine to be still executing after the first call
+static const char *LONG_RUNNING_QUERY = "SELECT SUM(a.range * b.range) FROM range(1000000) a, range(1000000) b";
+
+//! Calls SQLExecDirect until the asynchronous execution is done
+static SQLRETURN PollExecDirect(HSTMT hstmt, const std::string &query) {
+	SQLRETURN ret;
+	do {
+		ret = SQLExecDirect(hstmt, ConvertToSQLCHAR(query.c_str()), SQL_NTS);
+	} while (ret == SQL_STILL_EXECUTING);
+	return ret;
+}
+
+TEST_CASE("Test asynchronous execution with SQL_ATTR_ASYNC_ENABLE", "[odbc]") {
+	SQLHANDLE env;
+	SQLHANDLE dbc;
+
+	HSTMT hstmt = SQL_NULL_HSTMT;
+	HSTMT other_hstmt = SQL_NULL_HSTMT;
+
+	DRIVER_CONNECT_TO_DATABASE(env, dbc, "");
+
+	SQLUINTEGER async_mode = 0;
+	EXECUTE_AND_CHECK("SQLGetInfo (SQL_ASYNC_MODE)", dbc, SQLGetInfo, dbc, SQL_ASYNC_MODE, &async_mode,
+	                  sizeof(async_mode), nullptr);
+	REQUIRE(async_mode == SQL_AM_STATEMENT);
+
+	EXECUTE_AND_CHECK("SQLAllocHandle (HSTMT)", hstmt, SQLAllocHandle, SQL_HANDLE_STMT, dbc, &hstmt);
+	EXECUTE_AND_CHECK("SQLAllocHandle (HSTMT)", other_hstmt, SQLAllocHandle, SQL_HANDLE_STMT, dbc, &other_hstmt);
+	EXECUTE_AND_CHECK("SQLSetStmtAttr (SQL_ATTR_ASYNC_ENABLE)", hstmt, SQLSetStmtAttr, hstmt, SQL_ATTR_ASYNC_ENABLE,
+	                  ConvertToSQLPOINTER(SQL_ASYNC_ENABLE_ON), SQL_IS_UINTEGER);
+	SQLULEN async_enable = SQL_ASYNC_ENABLE_OFF;
+	EXECUTE_AND_CHECK("SQLGetStmtAttr (SQL_ATTR_ASYNC_ENABLE)", hstmt, SQLGetStmtAttr, hstmt, SQL_ATTR_ASYNC_ENABLE,
+	                  &async_enable, sizeof(async_enable), nullptr);
+	REQUIRE(async_enable == SQL_ASYNC_ENABLE_ON);
+
+	// The result is available once the execution stops returning SQL_STILL_EXECUTING
+	REQUIRE(PollExecDirect(hstmt, "SELECT SUM(range) FROM range(10000000)") == SQL_SUCCESS);
+	EXECUTE_AND_CHECK("SQLFetch", hstmt, SQLFetch, hstmt);
+	DATA_CHECK(hstmt, 1, "49999995000000");
+	EXECUTE_AND_CHECK("SQLFreeStmt (SQL_CLOSE)", hstmt, SQLFreeStmt, hstmt, SQL_CLOSE);
+
+	// Only the last statement of a multi-statement query runs asynchronously
+	REQUIRE(PollExecDirect(hstmt, "CREATE TABLE async_tbl AS SELECT range AS i FROM range(1000); "
+	                              "SELECT COUNT(*) FROM async_tbl") == SQL_SUCCESS);
+	EXECUTE_AND_CHECK("SQLFetch", hstmt, SQLFetch, hstmt);
+	DATA_CHECK(hstmt, 1, "1000");
+	EXECUTE_AND_CHECK("SQLFreeStmt (SQL_CLOSE)", hstmt, SQLFreeStmt, hstmt, SQL_CLOSE);
+
+	// Errors are reported by the call that completes the execution
+	REQUIRE(PollExecDirect(hstmt, "SELECT * FROM non_existent_table") == SQL_ERROR);
+
+	// Another statement cannot run while an asynchronous execution is in progress
+	SQLRETURN ret = SQLExecDirect(hstmt, ConvertToSQLCHAR(LONG_RUNNING_QUERY), SQL_NTS);
+	REQUIRE(ret == SQL_STILL_EXECUTING);
+	ret = SQLExecDirect(other_hstmt, ConvertToSQLCHAR("SELECT 1"), SQL_NTS);
+	REQUIRE(ret == SQL_ERROR);
+	std::string state;
+	std::string message;
+	ACCESS_DIAGNOSTIC(state, message, other_hstmt, SQL_HANDLE_STMT);
+	REQUIRE(state == "HY010");
+
+	// Catalog functions and the end of the transaction are rejected as well
+	ret = SQLTables(other_hstmt, nullptr, 0, nullptr, 0, nullptr, 0, nullptr, 0);
+	REQUIRE(ret == SQL_ERROR);
+	ACCESS_DIAGNOSTIC(state, message, other_hstmt, SQL_HANDLE_STMT);
+	REQUIRE(state == "HY010");
+	ret = SQLEndTran(SQL_HANDLE_DBC, dbc, SQL_COMMIT);
+	REQUIRE(ret == SQL_ERROR);
+	ACCESS_DIAGNOSTIC(state, message, dbc, SQL_HANDLE_DBC);
+	REQUIRE(state == "HY010");
+
+	// The canceled execution reports HY008 on the next poll
+	EXECUTE_AND_CHECK("SQLCancel", hstmt, SQLCancel, hstmt);
+	REQUIRE(PollExecDirect(hstmt, LONG_RUNNING_QUERY) == SQL_ERROR);
+	ACCESS_DIAGNOSTIC(state, message, hstmt, SQL_HANDLE_STMT);
+	REQUIRE(state == "HY008");
+	EXEC_SQL(other_hstmt, "SELECT 1");
+	EXECUTE_AND_CHECK("SQLFetch", other_hstmt, SQLFetch, other_hstmt);
+	DATA_CHECK(other_hstmt, 1, "1");
+
+	// The statement can be reused after the cancellation
+	REQUIRE(PollExecDirect(hstmt, "SELECT 42") == SQL_SUCCESS);
+	EXECUTE_AND_CHECK("SQLFetch", hstmt, SQLFetch, hstmt);
+	DATA_CHECK(hstmt, 1, "42");
+
+	EXECUTE_AND_CHECK("SQLFreeHandle (HSTMT)", other_hstmt, SQLFreeHandle, SQL_HANDLE_STMT, other_hstmt);
+	EXECUTE_AND_CHECK("SQLFreeHandle (HSTMT)", hstmt, SQLFreeHandle, SQL_HANDLE_STMT, hstmt);
+	DISCONNECT_FROM_DATABASE(env, dbc);
+}
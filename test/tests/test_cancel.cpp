@@ -0,0 +1,87 @@
+#include "odbc_test_common.h"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+using namespace odbc_test;
+
+//! Runs long enough on any machine to be still executing when it is canceled
+static const char *LONG_RUNNING_QUERY = "SELECT SUM(a.range * b.range) FROM range(1000000) a, range(1000000) b";
+
+TEST_CASE("Test SQLCancel only cancels the statement it is called on", "[odbc]") {
+	SQLHANDLE env;
+	SQLHANDLE dbc;
+	SQLHANDLE other_env;
+	SQLHANDLE other_dbc;
+
+	HSTMT slow = SQL_NULL_HSTMT;
+	HSTMT sibling = SQL_NULL_HSTMT;
+	HSTMT other = SQL_NULL_HSTMT;
+
+	DRIVER_CONNECT_TO_DATABASE(env, dbc, "");
+	DRIVER_CONNECT_TO_DATABASE(other_env, other_dbc, "");
+	EXECUTE_AND_CHECK("SQLAllocHandle (HSTMT)", slow, SQLAllocHandle, SQL_HANDLE_STMT, dbc, &slow);
+	EXECUTE_AND_CHECK("SQLAllocHandle (HSTMT)", sibling, SQLAllocHandle, SQL_HANDLE_STMT, dbc, &sibling);
+	EXECUTE_AND_CHECK("SQLAllocHandle (HSTMT)", other, SQLAllocHandle, SQL_HANDLE_STMT, other_dbc, &other);
+
+	// Canceling an idle statement has no effect
+	EXECUTE_AND_CHECK("SQLCancel", slow, SQLCancel, slow);
+	EXEC_SQL(slow, "SELECT 42");
+	EXECUTE_AND_CHECK("SQLFetch", slow, SQLFetch, slow);
+	DATA_CHECK(slow, 1, "42");
+
+	// The sibling keeps an open cursor on the same connection
+	EXEC_SQL(sibling, "SELECT range FROM range(5000)");
+	EXECUTE_AND_CHECK("SQLFetch", sibling, SQLFetch, sibling);
+	DATA_CHECK(sibling, 1, "0");
+
+	// Another connection runs a query concurrently
+	SQLRETURN other_ret = SQL_ERROR;
+	std::thread other_thread(
+	    [&]() { other_ret = SQLExecDirect(other, ConvertToSQLCHAR("SELECT COUNT(*) FROM range(50000000)"), SQL_NTS); });
+
+	std::atomic<bool> slow_done {false};
+	SQLRETURN slow_ret = SQL_SUCCESS;
+	auto start = std::chrono::steady_clock::now();
+	std::thread slow_thread([&]() {
+		slow_ret = SQLExecDirect(slow, ConvertToSQLCHAR(LONG_RUNNING_QUERY), SQL_NTS);
+		slow_done = true;
+	});
+	// The query may not have started yet, the cancellation is repeated until it is seen
+	while (!slow_done) {
+		std::this_thread::sleep_for(std::chrono::milliseconds(50));
+		EXECUTE_AND_CHECK("SQLCancel", slow, SQLCancel, slow);
+	}
+	slow_thread.join();
+	other_thread.join();
+	REQUIRE(std::chrono::steady_clock::now() - start < std::chrono::seconds(30));
+
+	REQUIRE(slow_ret == SQL_ERROR);
+	std::string state;
+	std::string message;
+	ACCESS_DIAGNOSTIC(state, message, slow, SQL_HANDLE_STMT);
+	REQUIRE(state == "HY008");
+
+	REQUIRE(other_ret == SQL_SUCCESS);
+	EXECUTE_AND_CHECK("SQLFetch", other, SQLFetch, other);
+	DATA_CHECK(other, 1, "50000000");
+
+	// The cursor of the sibling is not affected by the cancellation
+	for (int row = 1; row < 5000; row++) {
+		EXECUTE_AND_CHECK("SQLFetch", sibling, SQLFetch, sibling);
+	}
+	DATA_CHECK(sibling, 1, "4999");
+	REQUIRE(SQLFetch(sibling) == SQL_NO_DATA);
+
+	// The canceled statement can be reused
+	EXEC_SQL(slow, "SELECT 43");
+	EXECUTE_AND_CHECK("SQLFetch", slow, SQLFetch, slow);
+	DATA_CHECK(slow, 1, "43");
+
+	EXECUTE_AND_CHECK("SQLFreeHandle (HSTMT)", other, SQLFreeHandle, SQL_HANDLE_STMT, other);
+	EXECUTE_AND_CHECK("SQLFreeHandle (HSTMT)", sibling, SQLFreeHandle, SQL_HANDLE_STMT, sibling);
+	EXECUTE_AND_CHECK("SQLFreeHandle (HSTMT)", slow, SQLFreeHandle, SQL_HANDLE_STMT, slow);
+	DISCONNECT_FROM_DATABASE(other_env, other_dbc);
+	DISCONNECT_FROM_DATABASE(env, dbc);
+}
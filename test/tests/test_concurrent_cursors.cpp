@@ -0,0 +1,65 @@
+#include "odbc_test_common.h"
+
+using namespace odbc_test;
+
+//! Larger than a single chunk, so the first result is still streaming when the other statement executes
+static const int MASTER_ROWS = 5000;
+
+TEST_CASE("Test interleaved fetches from several statements of a connection", "[odbc]") {
+	SQLHANDLE env;
+	SQLHANDLE dbc;
+
+	HSTMT master = SQL_NULL_HSTMT;
+	HSTMT detail = SQL_NULL_HSTMT;
+
+	CONNECT_TO_DATABASE(env, dbc);
+
+	SQLUSMALLINT max_activities = 1;
+	EXECUTE_AND_CHECK("SQLGetInfo (SQL_MAX_CONCURRENT_ACTIVITIES)", dbc, SQLGetInfo, dbc, SQL_MAX_CONCURRENT_ACTIVITIES,
+	                  &max_activities, sizeof(max_activities), nullptr);
+	REQUIRE(max_activities == 0);
+
+	EXECUTE_AND_CHECK("SQLAllocHandle (HSTMT)", master, SQLAllocHandle, SQL_HANDLE_STMT, dbc, &master);
+	EXECUTE_AND_CHECK("SQLAllocHandle (HSTMT)", detail, SQLAllocHandle, SQL_HANDLE_STMT, dbc, &detail);
+
+	EXECUTE_AND_CHECK("SQLPrepare", detail, SQLPrepare, detail, ConvertToSQLCHAR("SELECT ? * 2"), SQL_NTS);
+	SQLINTEGER param = 0;
+	EXECUTE_AND_CHECK("SQLBindParameter", detail, SQLBindParameter, detail, 1, SQL_PARAM_INPUT, SQL_C_SLONG,
+	                  SQL_INTEGER, 0, 0, &param, 0, nullptr);
+
+	// Every row of the master result runs a detail query, the master cursor keeps its position
+	EXEC_SQL(master, "SELECT range::INTEGER FROM range(" + std::to_string(MASTER_ROWS) + ")");
+	for (int row = 0; row < MASTER_ROWS; row++) {
+		EXECUTE_AND_CHECK("SQLFetch (master)", master, SQLFetch, master);
+		SQLINTEGER master_value = -1;
+		EXECUTE_AND_CHECK("SQLGetData (master)", master, SQLGetData, master, 1, SQL_C_SLONG, &master_value,
+		                  sizeof(master_value), nullptr);
+		REQUIRE(master_value == row);
+
+		if (row % 1000 == 0) {
+			param = master_value;
+			EXECUTE_AND_CHECK("SQLExecute (detail)", detail, SQLExecute, detail);
+			EXECUTE_AND_CHECK("SQLFetch (detail)", detail, SQLFetch, detail);
+			DATA_CHECK(detail, 1, std::to_string(row * 2));
+			EXECUTE_AND_CHECK("SQLFreeStmt (SQL_CLOSE)", detail, SQLFreeStmt, detail, SQL_CLOSE);
+		}
+	}
+	SQLRETURN ret = SQLFetch(master);
+	REQUIRE(ret == SQL_NO_DATA);
+
+	// Two streaming results are fetched alternately
+	EXEC_SQL(master, "SELECT range FROM range(" + std::to_string(MASTER_ROWS) + ")");
+	EXECUTE_AND_CHECK("SQLFetch (master)", master, SQLFetch, master);
+	EXEC_SQL(detail, "SELECT range FROM range(" + std::to_string(MASTER_ROWS) + ", " +
+	                     std::to_string(2 * MASTER_ROWS) + ")");
+	for (int row = 1; row < MASTER_ROWS; row++) {
+		EXECUTE_AND_CHECK("SQLFetch (master)", master, SQLFetch, master);
+		DATA_CHECK(master, 1, std::to_string(row));
+		EXECUTE_AND_CHECK("SQLFetch (detail)", detail, SQLFetch, detail);
+		DATA_CHECK(detail, 1, std::to_string(MASTER_ROWS + row - 1));
+	}
+
+	EXECUTE_AND_CHECK("SQLFreeHandle (HSTMT)", detail, SQLFreeHandle, SQL_HANDLE_STMT, detail);
+	EXECUTE_AND_CHECK("SQLFreeHandle (HSTMT)", master, SQLFreeHandle, SQL_HANDLE_STMT, master);
+	DISCONNECT_FROM_DATABASE(env, dbc);
+}
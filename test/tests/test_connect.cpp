@@ -1,5 +1,7 @@
 #include "connect_helpers.h"
+#include "temp_directory.hpp"
 
+#include <chrono>
 #include <iostream>
 #include <thread>
 #include <vector>
@@ -175,6 +177,13 @@ static void TestSettingConfigs() {
 	// Test options trimming
 	SetConfig("foo1=bar1;  allow_unsigned_extensions = true ;foo2=bar2;", "allow_unsigned_extensions", "true");
 	SetConfig("foo1=bar1;  allow_unsigned_extensions = false ;foo2=bar2;", "allow_unsigned_extensions", "false");
+
+	// Test a long connection string, the last value of a repeated option is used
+	std::string long_conn_str;
+	for (int i = 0; i < 1000; i++) {
+		long_conn_str += "allow_unsigned_extensions=false;";
+	}
+	SetConfig(long_conn_str + "allow_unsigned_extensions=true", "allow_unsigned_extensions", "true");
 }
 
 static void CheckWorkerThreads(SQLHANDLE dbc, std::size_t expected_threads_count) {
@@ -369,6 +378,127 @@ TEST_CASE("Test worker threads", "[odbc]") {
 	DISCONNECT_FROM_DATABASE(env, dbc);
 }
 
+TEST_CASE("Test worker threads are shared by the connections to a database", "[odbc]") {
+	SQLHANDLE env1, env2;
+	SQLHANDLE dbc1, dbc2;
+
+	const auto processor_count = std::thread::hardware_concurrency();
+	if (0 == processor_count) {
+		std::cout << "Cannot detect the number of CPU cores, skipping 'Test worker threads are shared' test"
+		          << std::endl;
+		return;
+	}
+
+	TempDirectory tmpdir;
+	std::string conn_str = "database=" + tmpdir.path + "/threads.db";
+
+	// Both connections use the cached instance, which uses all cores by default
+	DRIVER_CONNECT_TO_DATABASE(env1, dbc1, conn_str);
+	CheckWorkerThreads(dbc1, processor_count);
+	DRIVER_CONNECT_TO_DATABASE(env2, dbc2, conn_str);
+	CheckWorkerThreads(dbc2, processor_count);
+	DISCONNECT_FROM_DATABASE(env2, dbc2);
+
+	// The number of threads is a database setting, it cannot differ between connections to the same database
+	EXECUTE_AND_CHECK("SQLAllocHandle (ENV)", nullptr, SQLAllocHandle, SQL_HANDLE_ENV, nullptr, &env2);
+	EXECUTE_AND_CHECK("SQLSetEnvAttr (SQL_ATTR_ODBC_VERSION ODBC3)", nullptr, SQLSetEnvAttr, env2,
+	                  SQL_ATTR_ODBC_VERSION, ConvertToSQLPOINTER(SQL_OV_ODBC3), 0);
+	EXECUTE_AND_CHECK("SQLAllocHandle (DBC)", nullptr, SQLAllocHandle, SQL_HANDLE_DBC, env2, &dbc2);
+	SQLRETURN ret = SQLDriverConnect(dbc2, nullptr, ConvertToSQLCHAR(conn_str + ";threads=1"), SQL_NTS, nullptr, 0,
+	                                 nullptr, SQL_DRIVER_COMPLETE);
+	REQUIRE(ret == SQL_ERROR);
+	EXECUTE_AND_CHECK("SQLFreeHandle (DBC)", nullptr, SQLFreeHandle, SQL_HANDLE_DBC, dbc2);
+	EXECUTE_AND_CHECK("SQLFreeHandle (ENV)", nullptr, SQLFreeHandle, SQL_HANDLE_ENV, env2);
+
+	DISCONNECT_FROM_DATABASE(env1, dbc1);
+}
+
+TEST_CASE("Test instance_idle_ttl_seconds keeps the database open after the last disconnect", "[odbc]") {
+	SQLHANDLE env;
+	SQLHANDLE dbc;
+
+	TempDirectory tmpdir;
+	std::string conn_str = "database=" + tmpdir.path + "/kept_alive.db";
+
+	DRIVER_CONNECT_TO_DATABASE(env, dbc, conn_str + ";instance_idle_ttl_seconds=1");
+	DISCONNECT_FROM_DATABASE(env, dbc);
+
+	// The instance is still cached, so a connection with a different 'threads' setting is rejected
+	EXECUTE_AND_CHECK("SQLAllocHandle (ENV)", nullptr, SQLAllocHandle, SQL_HANDLE_ENV, nullptr, &env);
+	EXECUTE_AND_CHECK("SQLSetEnvAttr (SQL_ATTR_ODBC_VERSION ODBC3)", nullptr, SQLSetEnvAttr, env, SQL_ATTR_ODBC_VERSION,
+	                  ConvertToSQLPOINTER(SQL_OV_ODBC3), 0);
+	EXECUTE_AND_CHECK("SQLAllocHandle (DBC)", nullptr, SQLAllocHandle, SQL_HANDLE_DBC, env, &dbc);
+	SQLRETURN ret = SQLDriverConnect(dbc, nullptr, ConvertToSQLCHAR(conn_str + ";threads=1"), SQL_NTS, nullptr, 0,
+	                                 nullptr, SQL_DRIVER_COMPLETE);
+	REQUIRE(ret == SQL_ERROR);
+	EXECUTE_AND_CHECK("SQLFreeHandle (DBC)", nullptr, SQLFreeHandle, SQL_HANDLE_DBC, dbc);
+	EXECUTE_AND_CHECK("SQLFreeHandle (ENV)", nullptr, SQLFreeHandle, SQL_HANDLE_ENV, env);
+
+	// After the grace period the instance is closed on the next connect and opened with the new setting
+	std::this_thread::sleep_for(std::chrono::milliseconds(1100));
+	DRIVER_CONNECT_TO_DATABASE(env, dbc, conn_str + ";threads=1");
+	CheckWorkerThreads(dbc, 1);
+	DISCONNECT_FROM_DATABASE(env, dbc);
+}
+
+TEST_CASE("Test instance_idle_ttl_seconds closes the database while the environment is allocated", "[odbc]") {
+	SQLHANDLE env;
+	SQLHANDLE dbc;
+
+	TempDirectory tmpdir;
+	std::string conn_str = "database=" + tmpdir.path + "/kept_alive_env.db";
+
+	// The environment and connection handles stay allocated, they must not keep the database open
+	DRIVER_CONNECT_TO_DATABASE(env, dbc, conn_str + ";instance_idle_ttl_seconds=1");
+	EXECUTE_AND_CHECK("SQLDisconnect", dbc, SQLDisconnect, dbc);
+
+	std::this_thread::sleep_for(std::chrono::milliseconds(1100));
+	EXECUTE_AND_CHECK("SQLDriverConnect", dbc, SQLDriverConnect, dbc, nullptr,
+	                  ConvertToSQLCHAR(conn_str + ";threads=1"), SQL_NTS, nullptr, 0, nullptr, SQL_DRIVER_COMPLETE);
+	CheckWorkerThreads(dbc, 1);
+	DISCONNECT_FROM_DATABASE(env, dbc);
+}
+
+TEST_CASE("Test named in-memory databases are shared between connections", "[odbc]") {
+	SQLHANDLE env1, env2;
+	SQLHANDLE dbc1, dbc2;
+	HSTMT hstmt1 = SQL_NULL_HSTMT;
+	HSTMT hstmt2 = SQL_NULL_HSTMT;
+
+	DRIVER_CONNECT_TO_DATABASE(env1, dbc1, "database=:memory:shared_scratch");
+	DRIVER_CONNECT_TO_DATABASE(env2, dbc2, "database=:memory:shared_scratch");
+	EXECUTE_AND_CHECK("SQLAllocHandle (HSTMT)", hstmt1, SQLAllocHandle, SQL_HANDLE_STMT, dbc1, &hstmt1);
+	EXECUTE_AND_CHECK("SQLAllocHandle (HSTMT)", hstmt2, SQLAllocHandle, SQL_HANDLE_STMT, dbc2, &hstmt2);
+
+	// A table created by one connection is visible to the other one
+	EXEC_SQL(hstmt1, "CREATE TABLE staging AS SELECT 42 AS answer");
+	EXEC_SQL(hstmt2, "SELECT answer FROM staging");
+	EXECUTE_AND_CHECK("SQLFetch", hstmt2, SQLFetch, hstmt2);
+	DATA_CHECK(hstmt2, 1, "42");
+	EXECUTE_AND_CHECK("SQLFreeHandle (HSTMT)", hstmt2, SQLFreeHandle, SQL_HANDLE_STMT, hstmt2);
+	DISCONNECT_FROM_DATABASE(env2, dbc2);
+
+	// An unnamed in-memory database stays private
+	DRIVER_CONNECT_TO_DATABASE(env2, dbc2, "database=:memory:");
+	EXECUTE_AND_CHECK("SQLAllocHandle (HSTMT)", hstmt2, SQLAllocHandle, SQL_HANDLE_STMT, dbc2, &hstmt2);
+	EXEC_SQL(hstmt2, "SELECT COUNT(*) FROM duckdb_tables() WHERE table_name = 'staging'");
+	EXECUTE_AND_CHECK("SQLFetch", hstmt2, SQLFetch, hstmt2);
+	DATA_CHECK(hstmt2, 1, "0");
+	EXECUTE_AND_CHECK("SQLFreeHandle (HSTMT)", hstmt2, SQLFreeHandle, SQL_HANDLE_STMT, hstmt2);
+	DISCONNECT_FROM_DATABASE(env2, dbc2);
+
+	// The database is dropped once its last connection is closed
+	EXECUTE_AND_CHECK("SQLFreeHandle (HSTMT)", hstmt1, SQLFreeHandle, SQL_HANDLE_STMT, hstmt1);
+	DISCONNECT_FROM_DATABASE(env1, dbc1);
+	DRIVER_CONNECT_TO_DATABASE(env1, dbc1, "database=:memory:shared_scratch");
+	EXECUTE_AND_CHECK("SQLAllocHandle (HSTMT)", hstmt1, SQLAllocHandle, SQL_HANDLE_STMT, dbc1, &hstmt1);
+	EXEC_SQL(hstmt1, "SELECT COUNT(*) FROM duckdb_tables() WHERE table_name = 'staging'");
+	EXECUTE_AND_CHECK("SQLFetch", hstmt1, SQLFetch, hstmt1);
+	DATA_CHECK(hstmt1, 1, "0");
+	EXECUTE_AND_CHECK("SQLFreeHandle (HSTMT)", hstmt1, SQLFreeHandle, SQL_HANDLE_STMT, hstmt1);
+	DISCONNECT_FROM_DATABASE(env1, dbc1);
+}
+
 TEST_CASE("Test connection string without null terminator", "[odbc]") {
 	SQLHANDLE env;
 	SQLHANDLE dbc;
@@ -0,0 +1,118 @@
+#include "connect_helpers.h"
+#include "odbc_attributes.hpp"
+#include "temp_directory.hpp"
+
+using namespace odbc_test;
+
+static uint64_t FetchUBigInt(SQLHANDLE dbc, const std::string &query) {
+	HSTMT hstmt = nullptr;
+	EXECUTE_AND_CHECK("SQLAllocHandle (HSTMT)", hstmt, SQLAllocHandle, SQL_HANDLE_STMT, dbc, &hstmt);
+	EXECUTE_AND_CHECK("SQLExecDirect", hstmt, SQLExecDirect, hstmt, ConvertToSQLCHAR(query), SQL_NTS);
+	EXECUTE_AND_CHECK("SQLFetch", hstmt, SQLFetch, hstmt);
+	uint64_t fetched = 0;
+	SQLLEN ind = 0;
+	EXECUTE_AND_CHECK("SQLGetData", hstmt, SQLGetData, hstmt, 1, SQL_C_UBIGINT, &fetched, sizeof(fetched), &ind);
+	REQUIRE(ind != SQL_NULL_DATA);
+	EXECUTE_AND_CHECK("SQLFreeHandle (HSTMT)", hstmt, SQLFreeHandle, SQL_HANDLE_STMT, hstmt);
+	return fetched;
+}
+
+static uint64_t GetPoolMetric(SQLHANDLE dbc, SQLINTEGER attribute) {
+	SQLUBIGINT value = 0;
+	EXECUTE_AND_CHECK("SQLGetConnectAttr", dbc, SQLGetConnectAttr, dbc, attribute, &value, sizeof(value), nullptr);
+	return value;
+}
+
+static void PooledConnect(SQLHANDLE dbc, const std::string &conn_str) {
+	EXECUTE_AND_CHECK("SQLDriverConnect", dbc, SQLDriverConnect, dbc, nullptr, ConvertToSQLCHAR(conn_str), SQL_NTS,
+	                  nullptr, 0, nullptr, SQL_DRIVER_COMPLETE);
+}
+
+TEST_CASE("Test connection pooling reuses reset connections", "[odbc]") {
+	SQLHANDLE env = nullptr;
+	SQLHANDLE dbc = nullptr;
+
+	EXECUTE_AND_CHECK("SQLAllocHandle (ENV)", nullptr, SQLAllocHandle, SQL_HANDLE_ENV, nullptr, &env);
+	EXECUTE_AND_CHECK("SQLSetEnvAttr (SQL_ATTR_ODBC_VERSION ODBC3)", nullptr, SQLSetEnvAttr, env, SQL_ATTR_ODBC_VERSION,
+	                  ConvertToSQLPOINTER(SQL_OV_ODBC3), 0);
+	EXECUTE_AND_CHECK("SQLSetEnvAttr (SQL_ATTR_CONNECTION_POOLING)", nullptr, SQLSetEnvAttr, env,
+	                  SQL_ATTR_CONNECTION_POOLING, ConvertToSQLPOINTER(SQL_CP_ONE_PER_HENV), 0);
+
+	SQLUINTEGER cp_match = 0;
+	EXECUTE_AND_CHECK("SQLGetEnvAttr (SQL_ATTR_CP_MATCH)", nullptr, SQLGetEnvAttr, env, SQL_ATTR_CP_MATCH, &cp_match,
+	                  sizeof(cp_match), nullptr);
+	REQUIRE(cp_match == SQL_CP_STRICT_MATCH);
+
+	EXECUTE_AND_CHECK("SQLAllocHandle (DBC)", nullptr, SQLAllocHandle, SQL_HANDLE_DBC, env, &dbc);
+
+	TempDirectory tmpdir;
+	std::string conn_str = "database=" + tmpdir.path + "/pooled.db";
+	PooledConnect(dbc, conn_str);
+	auto hits = GetPoolMetric(dbc, SQL_ATTR_DUCKDB_POOL_HITS);
+
+	// Session state must not survive the release of the connection
+	HSTMT hstmt = nullptr;
+	EXECUTE_AND_CHECK("SQLAllocHandle (HSTMT)", hstmt, SQLAllocHandle, SQL_HANDLE_STMT, dbc, &hstmt);
+	EXEC_SQL(hstmt, "SET VARIABLE pooled_var = 42");
+	EXECUTE_AND_CHECK("SQLFreeHandle (HSTMT)", hstmt, SQLFreeHandle, SQL_HANDLE_STMT, hstmt);
+	EXECUTE_AND_CHECK("SQLDisconnect", dbc, SQLDisconnect, dbc);
+
+	PooledConnect(dbc, conn_str);
+	REQUIRE(GetPoolMetric(dbc, SQL_ATTR_DUCKDB_POOL_HITS) == hits + 1);
+	REQUIRE(FetchUBigInt(dbc, "SELECT (getvariable('pooled_var') IS NULL)::UBIGINT") == 1);
+
+	// With strict matching a connection with different attributes is not reused
+	EXECUTE_AND_CHECK("SQLSetConnectAttr (SQL_ATTR_AUTOCOMMIT)", dbc, SQLSetConnectAttr, dbc, SQL_ATTR_AUTOCOMMIT,
+	                  reinterpret_cast<SQLPOINTER>(SQL_AUTOCOMMIT_OFF), SQL_IS_UINTEGER);
+	EXECUTE_AND_CHECK("SQLDisconnect", dbc, SQLDisconnect, dbc);
+	PooledConnect(dbc, conn_str);
+	REQUIRE(GetPoolMetric(dbc, SQL_ATTR_DUCKDB_POOL_HITS) == hits + 1);
+	REQUIRE(GetPoolMetric(dbc, SQL_ATTR_DUCKDB_POOL_IDLE) >= 1);
+
+	EXECUTE_AND_CHECK("SQLEndTran (SQL_ROLLBACK)", dbc, SQLEndTran, SQL_HANDLE_DBC, dbc, SQL_ROLLBACK);
+	EXECUTE_AND_CHECK("SQLDisconnect", dbc, SQLDisconnect, dbc);
+	EXECUTE_AND_CHECK("SQLFreeHandle (DBC)", nullptr, SQLFreeHandle, SQL_HANDLE_DBC, dbc);
+	// Freeing the environment closes its idle connections
+	EXECUTE_AND_CHECK("SQLFreeHandle (ENV)", nullptr, SQLFreeHandle, SQL_HANDLE_ENV, env);
+}
+
+TEST_CASE("Test connection pooling does not reuse sessions with temporary objects", "[odbc]") {
+	SQLHANDLE env = nullptr;
+	SQLHANDLE dbc = nullptr;
+
+	EXECUTE_AND_CHECK("SQLAllocHandle (ENV)", nullptr, SQLAllocHandle, SQL_HANDLE_ENV, nullptr, &env);
+	EXECUTE_AND_CHECK("SQLSetEnvAttr (SQL_ATTR_ODBC_VERSION ODBC3)", nullptr, SQLSetEnvAttr, env, SQL_ATTR_ODBC_VERSION,
+	                  ConvertToSQLPOINTER(SQL_OV_ODBC3), 0);
+	EXECUTE_AND_CHECK("SQLSetEnvAttr (SQL_ATTR_CONNECTION_POOLING)", nullptr, SQLSetEnvAttr, env,
+	                  SQL_ATTR_CONNECTION_POOLING, ConvertToSQLPOINTER(SQL_CP_ONE_PER_HENV), 0);
+	EXECUTE_AND_CHECK("SQLAllocHandle (DBC)", nullptr, SQLAllocHandle, SQL_HANDLE_DBC, env, &dbc);
+
+	TempDirectory tmpdir;
+	std::string conn_str = "database=" + tmpdir.path + "/pooled_temp.db";
+	PooledConnect(dbc, conn_str);
+
+	// The pool metrics are not visible in the catalog of the database
+	REQUIRE(FetchUBigInt(dbc, "SELECT COUNT(*) FROM duckdb_functions() WHERE function_name LIKE '%pool_metrics%'") ==
+	        0);
+
+	HSTMT hstmt = nullptr;
+	EXECUTE_AND_CHECK("SQLAllocHandle (HSTMT)", hstmt, SQLAllocHandle, SQL_HANDLE_STMT, dbc, &hstmt);
+	EXEC_SQL(hstmt, "CREATE TEMPORARY TABLE session_only (i INTEGER)");
+	EXECUTE_AND_CHECK("SQLFreeHandle (HSTMT)", hstmt, SQLFreeHandle, SQL_HANDLE_STMT, hstmt);
+	auto hits = GetPoolMetric(dbc, SQL_ATTR_DUCKDB_POOL_HITS);
+	EXECUTE_AND_CHECK("SQLDisconnect", dbc, SQLDisconnect, dbc);
+
+	// The connection owning a temporary table is closed instead of being pooled
+	PooledConnect(dbc, conn_str);
+	REQUIRE(GetPoolMetric(dbc, SQL_ATTR_DUCKDB_POOL_HITS) == hits);
+	REQUIRE(FetchUBigInt(dbc, "SELECT COUNT(*) FROM duckdb_tables() WHERE table_name = 'session_only'") == 0);
+
+	// A connection without temporary objects is reused
+	EXECUTE_AND_CHECK("SQLDisconnect", dbc, SQLDisconnect, dbc);
+	PooledConnect(dbc, conn_str);
+	REQUIRE(GetPoolMetric(dbc, SQL_ATTR_DUCKDB_POOL_HITS) == hits + 1);
+
+	EXECUTE_AND_CHECK("SQLDisconnect", dbc, SQLDisconnect, dbc);
+	EXECUTE_AND_CHECK("SQLFreeHandle (DBC)", nullptr, SQLFreeHandle, SQL_HANDLE_DBC, dbc);
+	EXECUTE_AND_CHECK("SQLFreeHandle (ENV)", nullptr, SQLFreeHandle, SQL_HANDLE_ENV, env);
+}
@@ -0,0 +1,149 @@
+#include "odbc_test_common.h"
+
+using namespace odbc_test;
+
+TEST_CASE("Test insert_batching option with repeated SQLExecute", "[odbc]") {
+	SQLHANDLE env;
+	SQLHANDLE dbc;
+
+	HSTMT hstmt = SQL_NULL_HSTMT;
+	HSTMT hstmt_select = SQL_NULL_HSTMT;
+
+	// Connect to the database with a batch size smaller than the number of inserted rows
+	DRIVER_CONNECT_TO_DATABASE(env, dbc, "DSN=duckdbmemory;insert_batching=3");
+
+	EXECUTE_AND_CHECK("SQLAllocHandle (HSTMT)", hstmt, SQLAllocHandle, SQL_HANDLE_STMT, dbc, &hstmt);
+	EXEC_SQL(hstmt, "CREATE TABLE batched (id INTEGER, name VARCHAR)");
+
+	EXECUTE_AND_CHECK("SQLPrepare", hstmt, SQLPrepare, hstmt,
+	                  ConvertToSQLCHAR("INSERT INTO batched (id, name) VALUES (?, ?)"), SQL_NTS);
+
+	int32_t id = 0;
+	SQLLEN id_len = sizeof(id);
+	char name[16];
+	SQLLEN name_len = SQL_NTS;
+	EXECUTE_AND_CHECK("SQLBindParameter", hstmt, SQLBindParameter, hstmt, 1, SQL_PARAM_INPUT, SQL_C_SLONG, SQL_INTEGER,
+	                  0, 0, &id, id_len, &id_len);
+	EXECUTE_AND_CHECK("SQLBindParameter", hstmt, SQLBindParameter, hstmt, 2, SQL_PARAM_INPUT, SQL_C_CHAR, SQL_VARCHAR,
+	                  sizeof(name), 0, name, sizeof(name), &name_len);
+
+	for (id = 1; id <= 5; id++) {
+		snprintf(name, sizeof(name), "name%d", id);
+		EXECUTE_AND_CHECK("SQLExecute", hstmt, SQLExecute, hstmt);
+
+		// Every buffered execution reports a single inserted row
+		SQLLEN row_count = 0;
+		EXECUTE_AND_CHECK("SQLRowCount", hstmt, SQLRowCount, hstmt, &row_count);
+		REQUIRE(row_count == 1);
+
+		// Like an executed INSERT, a buffered one has no cursor to describe
+		SQLLEN numeric_attr = 0;
+		REQUIRE(SQLColAttribute(hstmt, 1, SQL_DESC_TYPE, nullptr, 0, nullptr, &numeric_attr) == SQL_ERROR);
+		std::string state, message;
+		ACCESS_DIAGNOSTIC(state, message, hstmt, SQL_HANDLE_STMT);
+		REQUIRE(state == "07005");
+		EXECUTE_AND_CHECK("SQLFreeStmt (SQL_CLOSE)", hstmt, SQLFreeStmt, hstmt, SQL_CLOSE);
+	}
+
+	// Executing another statement inserts the rows that are still buffered
+	EXECUTE_AND_CHECK("SQLAllocHandle (HSTMT)", hstmt_select, SQLAllocHandle, SQL_HANDLE_STMT, dbc, &hstmt_select);
+	EXECUTE_AND_CHECK("SQLExecDirect", hstmt_select, SQLExecDirect, hstmt_select,
+	                  ConvertToSQLCHAR("SELECT COUNT(*), MAX(name) FROM batched"), SQL_NTS);
+	EXECUTE_AND_CHECK("SQLFetch", hstmt_select, SQLFetch, hstmt_select);
+	DATA_CHECK(hstmt_select, 1, "5");
+	DATA_CHECK(hstmt_select, 2, "name5");
+	EXECUTE_AND_CHECK("SQLFreeStmt (SQL_CLOSE)", hstmt_select, SQLFreeStmt, hstmt_select, SQL_CLOSE);
+
+	// Rows buffered in a transaction are discarded on rollback
+	EXECUTE_AND_CHECK("SQLSetConnectAttr (SQL_ATTR_AUTOCOMMIT)", dbc, SQLSetConnectAttr, dbc, SQL_ATTR_AUTOCOMMIT,
+	                  reinterpret_cast<SQLPOINTER>(SQL_AUTOCOMMIT_OFF), SQL_IS_UINTEGER);
+	snprintf(name, sizeof(name), "rolled back");
+	EXECUTE_AND_CHECK("SQLExecute", hstmt, SQLExecute, hstmt);
+	EXECUTE_AND_CHECK("SQLFreeStmt (SQL_CLOSE)", hstmt, SQLFreeStmt, hstmt, SQL_CLOSE);
+	EXECUTE_AND_CHECK("SQLEndTran (SQL_ROLLBACK)", dbc, SQLEndTran, SQL_HANDLE_DBC, dbc, SQL_ROLLBACK);
+	EXECUTE_AND_CHECK("SQLSetConnectAttr (SQL_ATTR_AUTOCOMMIT)", dbc, SQLSetConnectAttr, dbc, SQL_ATTR_AUTOCOMMIT,
+	                  reinterpret_cast<SQLPOINTER>(SQL_AUTOCOMMIT_ON), SQL_IS_UINTEGER);
+
+	EXECUTE_AND_CHECK("SQLExecDirect", hstmt_select, SQLExecDirect, hstmt_select,
+	                  ConvertToSQLCHAR("SELECT COUNT(*) FROM batched"), SQL_NTS);
+	EXECUTE_AND_CHECK("SQLFetch", hstmt_select, SQLFetch, hstmt_select);
+	DATA_CHECK(hstmt_select, 1, "5");
+
+	EXECUTE_AND_CHECK("SQLFreeStmt (SQL_CLOSE)", hstmt_select, SQLFreeStmt, hstmt_select, SQL_CLOSE);
+	EXECUTE_AND_CHECK("SQLFreeHandle (HSTMT)", hstmt_select, SQLFreeHandle, SQL_HANDLE_STMT, hstmt_select);
+	EXECUTE_AND_CHECK("SQLFreeHandle (HSTMT)", hstmt, SQLFreeHandle, SQL_HANDLE_STMT, hstmt);
+
+	DISCONNECT_FROM_DATABASE(env, dbc);
+}
+
+TEST_CASE("Test insert_batching option keeps acknowledged rows", "[odbc]") {
+	SQLHANDLE env;
+	SQLHANDLE dbc;
+
+	HSTMT hstmt = SQL_NULL_HSTMT;
+	HSTMT hstmt_select = SQL_NULL_HSTMT;
+
+	DRIVER_CONNECT_TO_DATABASE(env, dbc, "DSN=duckdbmemory;insert_batching=10");
+
+	EXECUTE_AND_CHECK("SQLAllocHandle (HSTMT)", hstmt, SQLAllocHandle, SQL_HANDLE_STMT, dbc, &hstmt);
+	EXECUTE_AND_CHECK("SQLAllocHandle (HSTMT)", hstmt_select, SQLAllocHandle, SQL_HANDLE_STMT, dbc, &hstmt_select);
+	EXEC_SQL(hstmt, "CREATE TABLE batched_kept (id INTEGER)");
+
+	EXECUTE_AND_CHECK("SQLPrepare", hstmt, SQLPrepare, hstmt, ConvertToSQLCHAR("INSERT INTO batched_kept VALUES (?)"),
+	                  SQL_NTS);
+	int32_t id = 0;
+	SQLLEN id_len = sizeof(id);
+	EXECUTE_AND_CHECK("SQLBindParameter", hstmt, SQLBindParameter, hstmt, 1, SQL_PARAM_INPUT, SQL_C_SLONG, SQL_INTEGER,
+	                  0, 0, &id, id_len, &id_len);
+	for (id = 1; id <= 2; id++) {
+		EXECUTE_AND_CHECK("SQLExecute", hstmt, SQLExecute, hstmt);
+		EXECUTE_AND_CHECK("SQLFreeStmt (SQL_CLOSE)", hstmt, SQLFreeStmt, hstmt, SQL_CLOSE);
+	}
+
+	// Catalog functions see the buffered rows
+	EXECUTE_AND_CHECK("SQLStatistics", hstmt_select, SQLStatistics, hstmt_select, nullptr, 0, nullptr, 0,
+	                  ConvertToSQLCHAR("batched_kept"), SQL_NTS, SQL_INDEX_ALL, SQL_ENSURE);
+	EXECUTE_AND_CHECK("SQLFetch", hstmt_select, SQLFetch, hstmt_select);
+	DATA_CHECK(hstmt_select, 11, "2");
+	EXECUTE_AND_CHECK("SQLFreeStmt (SQL_CLOSE)", hstmt_select, SQLFreeStmt, hstmt_select, SQL_CLOSE);
+
+	// In autocommit mode a rollback does not discard the rows that were reported as inserted
+	for (id = 3; id <= 4; id++) {
+		EXECUTE_AND_CHECK("SQLExecute", hstmt, SQLExecute, hstmt);
+		EXECUTE_AND_CHECK("SQLFreeStmt (SQL_CLOSE)", hstmt, SQLFreeStmt, hstmt, SQL_CLOSE);
+	}
+	SQLEndTran(SQL_HANDLE_DBC, dbc, SQL_ROLLBACK);
+
+	EXECUTE_AND_CHECK("SQLExecDirect", hstmt_select, SQLExecDirect, hstmt_select,
+	                  ConvertToSQLCHAR("SELECT COUNT(*) FROM batched_kept"), SQL_NTS);
+	EXECUTE_AND_CHECK("SQLFetch", hstmt_select, SQLFetch, hstmt_select);
+	DATA_CHECK(hstmt_select, 1, "4");
+
+	EXECUTE_AND_CHECK("SQLFreeStmt (SQL_CLOSE)", hstmt_select, SQLFreeStmt, hstmt_select, SQL_CLOSE);
+	EXECUTE_AND_CHECK("SQLFreeHandle (HSTMT)", hstmt_select, SQLFreeHandle, SQL_HANDLE_STMT, hstmt_select);
+	EXECUTE_AND_CHECK("SQLFreeHandle (HSTMT)", hstmt, SQLFreeHandle, SQL_HANDLE_STMT, hstmt);
+
+	DISCONNECT_FROM_DATABASE(env, dbc);
+}
+
+TEST_CASE("Test insert_batching option above the appender flush count", "[odbc]") {
+	SQLHANDLE env;
+	SQLHANDLE dbc;
+
+	EXECUTE_AND_CHECK("SQLAllocHandle (ENV)", nullptr, SQLAllocHandle, SQL_HANDLE_ENV, nullptr, &env);
+	EXECUTE_AND_CHECK("SQLSetEnvAttr (SQL_ATTR_ODBC_VERSION ODBC3)", nullptr, SQLSetEnvAttr, env,
+	                  SQL_ATTR_ODBC_VERSION, ConvertToSQLPOINTER(SQL_OV_ODBC3), 0);
+	EXECUTE_AND_CHECK("SQLAllocHandle (DBC)", nullptr, SQLAllocHandle, SQL_HANDLE_DBC, env, &dbc);
+
+	// The batch size is not silently reduced, the connection is refused
+	SQLRETURN ret = SQLDriverConnect(dbc, nullptr, ConvertToSQLCHAR("DSN=duckdbmemory;insert_batching=1000000"),
+	                                 SQL_NTS, nullptr, 0, nullptr, SQL_DRIVER_COMPLETE);
+	REQUIRE(ret == SQL_ERROR);
+	std::string state;
+	std::string message;
+	ACCESS_DIAGNOSTIC(state, message, dbc, SQL_HANDLE_DBC);
+	REQUIRE(state == "HY024");
+
+	EXECUTE_AND_CHECK("SQLFreeHandle (DBC)", nullptr, SQLFreeHandle, SQL_HANDLE_DBC, dbc);
+	EXECUTE_AND_CHECK("SQLFreeHandle (ENV)", nullptr, SQLFreeHandle, SQL_HANDLE_ENV, env);
+}
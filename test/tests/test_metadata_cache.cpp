@@ -0,0 +1,92 @@
+#include "odbc_test_common.h"
+
+#include <vector>
+
+using namespace odbc_test;
+
+//! Returns the names of the tables in the main schema that match the pattern
+static std::vector<std::string> ListTables(HSTMT hstmt, const std::string &pattern) {
+	EXECUTE_AND_CHECK("SQLTables", hstmt, SQLTables, hstmt, nullptr, 0, ConvertToSQLCHAR("main"), SQL_NTS,
+	                  ConvertToSQLCHAR(pattern.c_str()), SQL_NTS, nullptr, 0);
+	std::vector<std::string> tables;
+	while (SQLFetch(hstmt) != SQL_NO_DATA) {
+		SQLCHAR table_name[256];
+		EXECUTE_AND_CHECK("SQLGetData", hstmt, SQLGetData, hstmt, 3, SQL_C_CHAR, table_name, sizeof(table_name),
+		                  nullptr);
+		tables.push_back(ConvertToString(table_name));
+	}
+	EXECUTE_AND_CHECK("SQLFreeStmt (SQL_CLOSE)", hstmt, SQLFreeStmt, hstmt, SQL_CLOSE);
+	return tables;
+}
+
+TEST_CASE("Test metadata results are cached until the catalog changes", "[odbc]") {
+	SQLHANDLE env;
+	SQLHANDLE dbc;
+
+	HSTMT hstmt = SQL_NULL_HSTMT;
+	HSTMT other_hstmt = SQL_NULL_HSTMT;
+
+	CONNECT_TO_DATABASE(env, dbc);
+	EXECUTE_AND_CHECK("SQLAllocHandle (HSTMT)", hstmt, SQLAllocHandle, SQL_HANDLE_STMT, dbc, &hstmt);
+	EXECUTE_AND_CHECK("SQLAllocHandle (HSTMT)", other_hstmt, SQLAllocHandle, SQL_HANDLE_STMT, dbc, &other_hstmt);
+
+	EXEC_SQL(hstmt, "CREATE TABLE cache_a (i INTEGER)");
+	REQUIRE(ListTables(hstmt, "cache_%") == std::vector<std::string> {"cache_a"});
+	// The second call is served from the cache
+	REQUIRE(ListTables(hstmt, "cache_%") == std::vector<std::string> {"cache_a"});
+
+	// Committed DDL invalidates the cached result
+	EXEC_SQL(hstmt, "CREATE TABLE cache_b (i INTEGER, j VARCHAR)");
+	REQUIRE(ListTables(hstmt, "cache_%") == std::vector<std::string> {"cache_a", "cache_b"});
+	EXEC_SQL(hstmt, "DROP TABLE cache_a");
+	REQUIRE(ListTables(hstmt, "cache_%") == std::vector<std::string> {"cache_b"});
+
+	// Two cursors read the same cached result
+	for (int i = 0; i < 2; i++) {
+		EXECUTE_AND_CHECK("SQLColumns", hstmt, SQLColumns, hstmt, nullptr, 0, ConvertToSQLCHAR("main"), SQL_NTS,
+		                  ConvertToSQLCHAR("cache_b"), SQL_NTS, nullptr, 0);
+		EXECUTE_AND_CHECK("SQLColumns", other_hstmt, SQLColumns, other_hstmt, nullptr, 0, ConvertToSQLCHAR("main"),
+		                  SQL_NTS, ConvertToSQLCHAR("cache_b"), SQL_NTS, nullptr, 0);
+		EXECUTE_AND_CHECK("SQLFetch", hstmt, SQLFetch, hstmt);
+		DATA_CHECK(hstmt, 4, "i");
+		EXECUTE_AND_CHECK("SQLFetch", other_hstmt, SQLFetch, other_hstmt);
+		DATA_CHECK(other_hstmt, 4, "i");
+		EXECUTE_AND_CHECK("SQLFetch", other_hstmt, SQLFetch, other_hstmt);
+		DATA_CHECK(other_hstmt, 4, "j");
+		EXECUTE_AND_CHECK("SQLFetch", hstmt, SQLFetch, hstmt);
+		DATA_CHECK(hstmt, 4, "j");
+		REQUIRE(SQLFetch(hstmt) == SQL_NO_DATA);
+		REQUIRE(SQLFetch(other_hstmt) == SQL_NO_DATA);
+		EXECUTE_AND_CHECK("SQLFreeStmt (SQL_CLOSE)", hstmt, SQLFreeStmt, hstmt, SQL_CLOSE);
+		EXECUTE_AND_CHECK("SQLFreeStmt (SQL_CLOSE)", other_hstmt, SQLFreeStmt, other_hstmt, SQL_CLOSE);
+	}
+	EXEC_SQL(hstmt, "ALTER TABLE cache_b ADD COLUMN k DOUBLE");
+	EXECUTE_AND_CHECK("SQLColumns", hstmt, SQLColumns, hstmt, nullptr, 0, ConvertToSQLCHAR("main"), SQL_NTS,
+	                  ConvertToSQLCHAR("cache_b"), SQL_NTS, ConvertToSQLCHAR("k"), SQL_NTS);
+	EXECUTE_AND_CHECK("SQLFetch", hstmt, SQLFetch, hstmt);
+	DATA_CHECK(hstmt, 4, "k");
+	EXECUTE_AND_CHECK("SQLFreeStmt (SQL_CLOSE)", hstmt, SQLFreeStmt, hstmt, SQL_CLOSE);
+
+	// Uncommitted DDL is only visible to the transaction that made it
+	EXECUTE_AND_CHECK("SQLSetConnectAttr (SQL_ATTR_AUTOCOMMIT)", dbc, SQLSetConnectAttr, dbc, SQL_ATTR_AUTOCOMMIT,
+	                  ConvertToSQLPOINTER(SQL_AUTOCOMMIT_OFF), SQL_IS_UINTEGER);
+	EXEC_SQL(hstmt, "CREATE TABLE cache_c (i INTEGER)");
+	REQUIRE(ListTables(hstmt, "cache_%") == std::vector<std::string> {"cache_b", "cache_c"});
+	EXECUTE_AND_CHECK("SQLEndTran", dbc, SQLEndTran, SQL_HANDLE_DBC, dbc, SQL_ROLLBACK);
+	REQUIRE(ListTables(hstmt, "cache_%") == std::vector<std::string> {"cache_b"});
+	EXECUTE_AND_CHECK("SQLSetConnectAttr (SQL_ATTR_AUTOCOMMIT)", dbc, SQLSetConnectAttr, dbc, SQL_ATTR_AUTOCOMMIT,
+	                  ConvertToSQLPOINTER(SQL_AUTOCOMMIT_ON), SQL_IS_UINTEGER);
+
+	// Temporary tables are private to the connection
+	EXEC_SQL(hstmt, "CREATE TEMPORARY TABLE cache_temp (i INTEGER)");
+	EXECUTE_AND_CHECK("SQLTables", hstmt, SQLTables, hstmt, nullptr, 0, nullptr, 0, ConvertToSQLCHAR("cache_temp"),
+	                  SQL_NTS, nullptr, 0);
+	EXECUTE_AND_CHECK("SQLFetch", hstmt, SQLFetch, hstmt);
+	DATA_CHECK(hstmt, 3, "cache_temp");
+	EXECUTE_AND_CHECK("SQLFreeStmt (SQL_CLOSE)", hstmt, SQLFreeStmt, hstmt, SQL_CLOSE);
+	EXEC_SQL(hstmt, "DROP TABLE cache_b");
+
+	EXECUTE_AND_CHECK("SQLFreeHandle (HSTMT)", other_hstmt, SQLFreeHandle, SQL_HANDLE_STMT, other_hstmt);
+	EXECUTE_AND_CHECK("SQLFreeHandle (HSTMT)", hstmt, SQLFreeHandle, SQL_HANDLE_STMT, hstmt);
+	DISCONNECT_FROM_DATABASE(env, dbc);
+}
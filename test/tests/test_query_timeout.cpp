@@ -0,0 +1,53 @@
+#include "odbc_test_common.h"
+
+#include <chrono>
+
+using namespace odbc_test;
+
+//! Runs long enough on any machine to be interrupted by a 1 second timeout
+static const char *LONG_RUNNING_QUERY = "SELECT SUM(a.range * b.range) FROM range(1000000) a, range(1000000) b";
+
+TEST_CASE("Test SQL_ATTR_QUERY_TIMEOUT interrupts long running queries", "[odbc]") {
+	SQLHANDLE env;
+	SQLHANDLE dbc;
+
+	HSTMT hstmt = SQL_NULL_HSTMT;
+
+	DRIVER_CONNECT_TO_DATABASE(env, dbc, "");
+	EXECUTE_AND_CHECK("SQLAllocHandle (HSTMT)", hstmt, SQLAllocHandle, SQL_HANDLE_STMT, dbc, &hstmt);
+
+	SQLULEN timeout = 0;
+	EXECUTE_AND_CHECK("SQLGetStmtAttr (SQL_ATTR_QUERY_TIMEOUT)", hstmt, SQLGetStmtAttr, hstmt, SQL_ATTR_QUERY_TIMEOUT,
+	                  &timeout, sizeof(timeout), nullptr);
+	REQUIRE(timeout == 0);
+	EXECUTE_AND_CHECK("SQLSetStmtAttr (SQL_ATTR_QUERY_TIMEOUT)", hstmt, SQLSetStmtAttr, hstmt, SQL_ATTR_QUERY_TIMEOUT,
+	                  ConvertToSQLPOINTER(1), SQL_IS_UINTEGER);
+	EXECUTE_AND_CHECK("SQLGetStmtAttr (SQL_ATTR_QUERY_TIMEOUT)", hstmt, SQLGetStmtAttr, hstmt, SQL_ATTR_QUERY_TIMEOUT,
+	                  &timeout, sizeof(timeout), nullptr);
+	REQUIRE(timeout == 1);
+
+	// Short queries are not affected by the timeout
+	EXEC_SQL(hstmt, "SELECT 42");
+	EXECUTE_AND_CHECK("SQLFetch", hstmt, SQLFetch, hstmt);
+	DATA_CHECK(hstmt, 1, "42");
+	EXECUTE_AND_CHECK("SQLFreeStmt (SQL_CLOSE)", hstmt, SQLFreeStmt, hstmt, SQL_CLOSE);
+
+	auto start = std::chrono::steady_clock::now();
+	SQLRETURN ret = SQLExecDirect(hstmt, ConvertToSQLCHAR(LONG_RUNNING_QUERY), SQL_NTS);
+	auto elapsed = std::chrono::steady_clock::now() - start;
+	REQUIRE(ret == SQL_ERROR);
+	REQUIRE(elapsed < std::chrono::seconds(30));
+
+	std::string state;
+	std::string message;
+	ACCESS_DIAGNOSTIC(state, message, hstmt, SQL_HANDLE_STMT);
+	REQUIRE(state == "HYT00");
+
+	// The statement can be reused after the timeout
+	EXEC_SQL(hstmt, "SELECT 43");
+	EXECUTE_AND_CHECK("SQLFetch", hstmt, SQLFetch, hstmt);
+	DATA_CHECK(hstmt, 1, "43");
+
+	EXECUTE_AND_CHECK("SQLFreeHandle (HSTMT)", hstmt, SQLFreeHandle, SQL_HANDLE_STMT, hstmt);
+	DISCONNECT_FROM_DATABASE(env, dbc);
+}
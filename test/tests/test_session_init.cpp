@@ -53,6 +53,34 @@ INSERT INTO tab1 VALUES(42);
 	DISCONNECT_FROM_DATABASE(env, dbc);
 }
 
+TEST_CASE("Test session init marker with comments and line breaks", "[odbc]") {
+	SQLHANDLE env = nullptr;
+	SQLHANDLE dbc = nullptr;
+	HSTMT hstmt = nullptr;
+
+	TempDirectory tmpdir;
+	std::string path = tmpdir.path + "/session_init.sql";
+	WriteStringToFile(path, "/* DUCKDB_CONNECTION_INIT */ CREATE TABLE tab1(col1 int);\n"
+	                        "/*\n\tDUCKDB_CONNECTION_INIT_BELOW_MARKER\r\n*/INSERT INTO tab1 VALUES(42);");
+	UserOdbcIni odbc_ini({{"session_init_sql_file", path}});
+
+	CONNECT_TO_DATABASE(env, dbc);
+
+	EXECUTE_AND_CHECK("SQLAllocHandle (HSTMT)", hstmt, SQLAllocHandle, SQL_HANDLE_STMT, dbc, &hstmt);
+	EXECUTE_AND_CHECK("SQLExecDirect", hstmt, SQLExecDirect, hstmt, ConvertToSQLCHAR("SELECT count(*) FROM tab1"),
+	                  SQL_NTS);
+	int32_t fetched = -1;
+	EXECUTE_AND_CHECK("SQLFetch", hstmt, SQLFetch, hstmt);
+	EXECUTE_AND_CHECK("SQLGetData", hstmt, SQLGetData, hstmt, 1, SQL_C_SLONG, &fetched, sizeof(fetched), nullptr);
+	REQUIRE(fetched == 1);
+	EXECUTE_AND_CHECK("SQLFreeStmt (HSTMT)", hstmt, SQLFreeStmt, hstmt, SQL_CLOSE);
+	EXECUTE_AND_CHECK("SQLExecDirect", hstmt, SQLExecDirect, hstmt, ConvertToSQLCHAR("DROP TABLE tab1"), SQL_NTS);
+
+	EXECUTE_AND_CHECK("SQLFreeStmt (HSTMT)", hstmt, SQLFreeStmt, hstmt, SQL_CLOSE);
+	EXECUTE_AND_CHECK("SQLFreeHandle (HSTMT)", hstmt, SQLFreeHandle, SQL_HANDLE_STMT, hstmt);
+	DISCONNECT_FROM_DATABASE(env, dbc);
+}
+
 TEST_CASE("Test session init for connection only", "[odbc]") {
 	SQLHANDLE env = nullptr;
 	SQLHANDLE dbc = nullptr;
@@ -253,7 +281,8 @@ INSERT INTO tab1 VALUES(43);
 	ACCESS_DIAGNOSTIC_WIDE(state, message, dbc, SQL_HANDLE_DBC);
 
 	REQUIRE(state == "IM003");
-	REQUIRE(message.length() > 0);
+	REQUIRE(message.find("'/* DUCKDB_CONNECTION_INIT_BELOW_MARKER */' can only be specified once") !=
+	        std::string::npos);
 
 	EXECUTE_AND_CHECK("SQLFreeHandle(SQL_HANDLE_ENV)", nullptr, SQLFreeHandle, SQL_HANDLE_ENV, env);
 	EXECUTE_AND_CHECK("SQLFreeHandle(SQL_HANDLE_DBC)", nullptr, SQLFreeHandle, SQL_HANDLE_DBC, dbc);
@@ -148,3 +148,142 @@ TEST_CASE("Test 'bound_all_parameters=false' case with SQLPrepare and SQLExecute
 
 	DISCONNECT_FROM_DATABASE(env, dbc);
 }
+
+TEST_CASE("Test 'bound_all_parameters=false' case with repeated SQLExecute", "[odbc]") {
+	SQLHANDLE env;
+	SQLHANDLE dbc;
+
+	HSTMT hstmt = SQL_NULL_HSTMT;
+
+	// Connect to the database using SQLConnect
+	CONNECT_TO_DATABASE(env, dbc);
+
+	// Allocate a statement handle
+	EXECUTE_AND_CHECK("SQLAllocHandle (HSTMT)", hstmt, SQLAllocHandle, SQL_HANDLE_STMT, dbc, &hstmt);
+
+	// Prepare the query
+	SQLRETURN ret_prepare = SQLPrepare(hstmt, ConvertToSQLCHAR("SELECT ? AS a"), SQL_NTS);
+	REQUIRE(ret_prepare == SQL_SUCCESS_WITH_INFO);
+
+	int32_t param = 0;
+	SQLLEN param_len = sizeof(param);
+	EXECUTE_AND_CHECK("SQLBindParameter", hstmt, SQLBindParameter, hstmt, 1, SQL_PARAM_INPUT, SQL_C_SLONG, SQL_INTEGER,
+	                  0, 0, &param, param_len, &param_len);
+
+	// Execute multiple times with the same parameter types, the IRD must stay correct
+	for (int32_t i = 0; i < 3; i++) {
+		param = i;
+		EXECUTE_AND_CHECK("SQLExecute", hstmt, SQLExecute, hstmt);
+
+		SQLLEN ctype = -1;
+		EXECUTE_AND_CHECK("SQLColAttribute", hstmt, SQLColAttribute, hstmt, 1, SQL_DESC_CONCISE_TYPE, nullptr, 0,
+		                  nullptr, &ctype);
+		REQUIRE(ctype == SQL_INTEGER);
+
+		EXECUTE_AND_CHECK("SQLFetch", hstmt, SQLFetch, hstmt);
+		int32_t fetched = -1;
+		EXECUTE_AND_CHECK("SQLGetData", hstmt, SQLGetData, hstmt, 1, SQL_C_SLONG, &fetched, sizeof(fetched), nullptr);
+		REQUIRE(fetched == i);
+		EXECUTE_AND_CHECK("SQLFreeStmt (CLOSE)", hstmt, SQLFreeStmt, hstmt, SQL_CLOSE);
+	}
+
+	// Changing the parameter type must re-fill the IRD
+	EXECUTE_AND_CHECK("SQLFreeStmt (PARAMS)", hstmt, SQLFreeStmt, hstmt, SQL_RESET_PARAMS);
+	std::string str_param = "foo";
+	SQLLEN str_param_len = str_param.length();
+	EXECUTE_AND_CHECK("SQLBindParameter", hstmt, SQLBindParameter, hstmt, 1, SQL_PARAM_INPUT, SQL_C_CHAR, SQL_VARCHAR,
+	                  str_param_len, 0, const_cast<char *>(str_param.c_str()), str_param_len, &str_param_len);
+	EXECUTE_AND_CHECK("SQLExecute", hstmt, SQLExecute, hstmt);
+
+	SQLLEN ctype = -1;
+	EXECUTE_AND_CHECK("SQLColAttribute", hstmt, SQLColAttribute, hstmt, 1, SQL_DESC_CONCISE_TYPE, nullptr, 0, nullptr,
+	                  &ctype);
+	REQUIRE(ctype == SQL_VARCHAR);
+
+	// Free the statement handle
+	EXECUTE_AND_CHECK("SQLFreeStmt (HSTMT)", hstmt, SQLFreeStmt, hstmt, SQL_CLOSE);
+	EXECUTE_AND_CHECK("SQLFreeHandle (HSTMT)", hstmt, SQLFreeHandle, SQL_HANDLE_STMT, hstmt);
+
+	DISCONNECT_FROM_DATABASE(env, dbc);
+}
+
+TEST_CASE("Test 'bound_all_parameters=false' case described before SQLExecute", "[odbc]") {
+	SQLHANDLE env;
+	SQLHANDLE dbc;
+
+	HSTMT hstmt = SQL_NULL_HSTMT;
+
+	// Connect to the database using SQLConnect
+	CONNECT_TO_DATABASE(env, dbc);
+
+	// Allocate a statement handle
+	EXECUTE_AND_CHECK("SQLAllocHandle (HSTMT)", hstmt, SQLAllocHandle, SQL_HANDLE_STMT, dbc, &hstmt);
+
+	EXECUTE_AND_CHECK("SQLExecDirect (CREATE)", hstmt, SQLExecDirect, hstmt,
+	                  ConvertToSQLCHAR("CREATE TABLE describe_t AS SELECT 1 AS col"), SQL_NTS);
+
+	// Prepare the query
+	SQLRETURN ret_prepare = SQLPrepare(hstmt, ConvertToSQLCHAR("SELECT ? + col AS a FROM describe_t"), SQL_NTS);
+	REQUIRE(ret_prepare == SQL_SUCCESS_WITH_INFO);
+
+	// Without a declared parameter type the result columns are unknown
+	SQLSMALLINT col_count = -1;
+	EXECUTE_AND_CHECK("SQLNumResultCols", hstmt, SQLNumResultCols, hstmt, &col_count);
+	REQUIRE(col_count == 0);
+
+	int32_t param = 41;
+	SQLLEN param_len = sizeof(param);
+	EXECUTE_AND_CHECK("SQLBindParameter", hstmt, SQLBindParameter, hstmt, 1, SQL_PARAM_INPUT, SQL_C_SLONG, SQL_INTEGER,
+	                  0, 0, &param, param_len, &param_len);
+
+	// The result columns are described from the declared parameter type without executing the query
+	EXECUTE_AND_CHECK("SQLNumResultCols", hstmt, SQLNumResultCols, hstmt, &col_count);
+	REQUIRE(col_count == 1);
+	SQLCHAR col_name[64];
+	SQLSMALLINT col_name_len = 0;
+	SQLSMALLINT data_type = 0;
+	SQLULEN col_size = 0;
+	SQLSMALLINT decimal_digits = 0;
+	SQLSMALLINT nullable = 0;
+	EXECUTE_AND_CHECK("SQLDescribeCol", hstmt, SQLDescribeCol, hstmt, 1, col_name, sizeof(col_name), &col_name_len,
+	                  &data_type, &col_size, &decimal_digits, &nullable);
+	REQUIRE(ConvertToString(col_name) == "a");
+	REQUIRE(data_type == SQL_INTEGER);
+
+	// Executing with the declared type keeps the description
+	EXECUTE_AND_CHECK("SQLExecute", hstmt, SQLExecute, hstmt);
+	SQLLEN ctype = -1;
+	EXECUTE_AND_CHECK("SQLColAttribute", hstmt, SQLColAttribute, hstmt, 1, SQL_DESC_CONCISE_TYPE, nullptr, 0, nullptr,
+	                  &ctype);
+	REQUIRE(ctype == SQL_INTEGER);
+	EXECUTE_AND_CHECK("SQLFetch", hstmt, SQLFetch, hstmt);
+	int32_t fetched = -1;
+	EXECUTE_AND_CHECK("SQLGetData", hstmt, SQLGetData, hstmt, 1, SQL_C_SLONG, &fetched, sizeof(fetched), nullptr);
+	REQUIRE(fetched == 42);
+	EXECUTE_AND_CHECK("SQLFreeStmt (HSTMT)", hstmt, SQLFreeStmt, hstmt, SQL_CLOSE);
+
+	// Binding the parameter with another type describes the result columns again
+	int64_t big_param = 41;
+	SQLLEN big_param_len = sizeof(big_param);
+	EXECUTE_AND_CHECK("SQLBindParameter", hstmt, SQLBindParameter, hstmt, 1, SQL_PARAM_INPUT, SQL_C_SBIGINT,
+	                  SQL_BIGINT, 0, 0, &big_param, big_param_len, &big_param_len);
+	EXECUTE_AND_CHECK("SQLDescribeCol", hstmt, SQLDescribeCol, hstmt, 1, col_name, sizeof(col_name), &col_name_len,
+	                  &data_type, &col_size, &decimal_digits, &nullable);
+	REQUIRE(data_type == SQL_BIGINT);
+
+	// So does changing the type in the IPD
+	SQLHDESC ipd = nullptr;
+	EXECUTE_AND_CHECK("SQLGetStmtAttr (SQL_ATTR_IMP_PARAM_DESC)", hstmt, SQLGetStmtAttr, hstmt,
+	                  SQL_ATTR_IMP_PARAM_DESC, &ipd, 0, nullptr);
+	SQLSMALLINT ipd_type = SQL_DOUBLE;
+	EXECUTE_AND_CHECK("SQLSetDescField (SQL_DESC_TYPE)", nullptr, SQLSetDescField, ipd, 1, SQL_DESC_TYPE, &ipd_type,
+	                  0);
+	EXECUTE_AND_CHECK("SQLDescribeCol", hstmt, SQLDescribeCol, hstmt, 1, col_name, sizeof(col_name), &col_name_len,
+	                  &data_type, &col_size, &decimal_digits, &nullable);
+	REQUIRE(data_type == SQL_DOUBLE);
+
+	// Free the statement handle
+	EXECUTE_AND_CHECK("SQLFreeHandle (HSTMT)", hstmt, SQLFreeHandle, SQL_HANDLE_STMT, hstmt);
+
+	DISCONNECT_FROM_DATABASE(env, dbc);
+}
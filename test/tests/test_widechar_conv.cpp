@@ -380,3 +380,52 @@ TEST_CASE("Test utf16_conv utility", "[odbc_widechar]") {
 	std::copy(conv.utf8_str, conv.utf8_str + conv.utf8_len(), std::back_inserter(utf8_vec));
 	REQUIRE(std::equal(utf8_vec.begin(), utf8_vec.end(), hello_bg_utf8.begin()));
 }
+
+TEST_CASE("Test utf16_to_utf8 function", "[odbc_widechar]") {
+	std::string res;
+	SECTION("hello") {
+		REQUIRE(utf16_to_utf8(hello_bg_utf16.data(), static_cast<SQLLEN>(hello_bg_utf16.size()), res) ==
+		        hello_bg_utf16.size());
+		REQUIRE(res == std::string(hello_bg_utf8.begin(), hello_bg_utf8.end()));
+	}
+	SECTION("hello NTS") {
+		std::vector<SQLWCHAR> in_buf(hello_bg_utf16.begin(), hello_bg_utf16.end());
+		in_buf.push_back(0);
+		REQUIRE(utf16_to_utf8(in_buf.data(), SQL_NTS, res) == hello_bg_utf16.size());
+		REQUIRE(res == std::string(hello_bg_utf8.begin(), hello_bg_utf8.end()));
+	}
+	SECTION("ASCII") {
+		std::string ascii = "The quick brown fox jumps over the lazy dog";
+		std::vector<SQLWCHAR> in_buf(ascii.begin(), ascii.end());
+		REQUIRE(utf16_to_utf8(in_buf.data(), static_cast<SQLLEN>(in_buf.size()), res) == ascii.size());
+		REQUIRE(res == ascii);
+		in_buf.push_back(0);
+		REQUIRE(utf16_to_utf8(in_buf.data(), SQL_NTS, res) == ascii.size());
+		REQUIRE(res == ascii);
+	}
+	SECTION("empty") {
+		const SQLWCHAR empty = 0;
+		REQUIRE(utf16_to_utf8(&empty, SQL_NTS, res) == 0);
+		REQUIRE(res.empty());
+		REQUIRE(utf16_to_utf8(nullptr, 0, res) == 0);
+		REQUIRE(res.empty());
+	}
+	SECTION("matches utf16_to_utf8_lenient") {
+		std::vector<std::vector<SQLWCHAR>> inputs = {invalid_utf16_surrogate, incomplete_utf16_surrogate,
+		                                             valid_utf16_surrogate};
+		for (auto &input : inputs) {
+			std::vector<SQLWCHAR> in_buf;
+			auto in_buf_bi = std::back_inserter(in_buf);
+			std::copy(hello_bg_utf16.begin(), hello_bg_utf16.end(), in_buf_bi);
+			std::copy(input.begin(), input.end(), in_buf_bi);
+			in_buf.push_back('a');
+			std::copy(hello_bg_utf16.begin(), hello_bg_utf16.end(), in_buf_bi);
+			auto expected = utf16_to_utf8_lenient(in_buf.data(), in_buf.size());
+			utf16_to_utf8(in_buf.data(), static_cast<SQLLEN>(in_buf.size()), res);
+			REQUIRE(res == std::string(expected.begin(), expected.end()));
+			in_buf.push_back(0);
+			utf16_to_utf8(in_buf.data(), SQL_NTS, res);
+			REQUIRE(res == std::string(expected.begin(), expected.end()));
+		}
+	}
+}